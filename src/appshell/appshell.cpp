@@ -54,9 +54,31 @@ AppShell::AppShell()
 {
 }
 
-void AppShell::addModule(modularity::IModuleSetup* module)
+void AppShell::addModule(modularity::IModuleSetup* module, ModuleRunMode runMode)
 {
     m_modules.push_back(module);
+
+    if (runMode == ModuleRunMode::EditorOnly) {
+        m_editorOnlyModules.insert(module);
+    }
+}
+
+bool AppShell::isEditorOnlyModule(const modularity::IModuleSetup* module) const
+{
+    return m_editorOnlyModules.find(module) != m_editorOnlyModules.cend();
+}
+
+template<typename Func>
+void AppShell::measureModuleSetup(const modularity::IModuleSetup* module, const Func& func)
+{
+    //! NOTE The setup time of each module is printed with the profiler data on quit
+    auto it = m_modulesProfilerTags.find(module);
+    if (it == m_modulesProfilerTags.end()) {
+        it = m_modulesProfilerTags.emplace(module, "module setup: " + module->moduleName()).first;
+    }
+
+    haw::profiler::FuncMarker marker(it->second);
+    func();
 }
 
 int AppShell::run(int argc, char** argv)
@@ -101,6 +123,20 @@ int AppShell::run(int argc, char** argv)
     QCoreApplication::setOrganizationDomain("musescore.org");
     QCoreApplication::setApplicationVersion(QString::fromStdString(framework::Version::fullVersion()));
 
+    // ====================================================
+    // Parse command line options
+    // ====================================================
+    CommandLineController commandLine;
+    commandLine.parse(QCoreApplication::arguments());
+
+    //! NOTE In the converter mode the editor only modules are not set up at all
+    QList<mu::modularity::IModuleSetup*> startupModules;
+    for (mu::modularity::IModuleSetup* m : m_modules) {
+        if (commandLine.runMode() == framework::IApplication::RunMode::Editor || !isEditorOnlyModule(m)) {
+            startupModules.push_back(m);
+        }
+    }
+
     // ====================================================
     // Setup modules: Resources, Exports, Imports, UiTypes
     // ====================================================
@@ -108,25 +144,25 @@ int AppShell::run(int argc, char** argv)
     globalModule.registerExports();
     globalModule.registerUiTypes();
 
-    for (mu::modularity::IModuleSetup* m : m_modules) {
+    for (mu::modularity::IModuleSetup* m : startupModules) {
         m->registerResources();
     }
 
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerExports();
+    for (mu::modularity::IModuleSetup* m : startupModules) {
+        measureModuleSetup(m, [m]() { m->registerExports(); });
     }
 
     globalModule.resolveImports();
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerUiTypes();
-        m->resolveImports();
+    for (mu::modularity::IModuleSetup* m : startupModules) {
+        measureModuleSetup(m, [m]() {
+            m->registerUiTypes();
+            m->resolveImports();
+        });
     }
 
     // ====================================================
-    // Parse and apply command line options
+    // Apply command line options
     // ====================================================
-    CommandLineController commandLine;
-    commandLine.parse(QCoreApplication::arguments());
     commandLine.apply();
     framework::IApplication::RunMode runMode = muapplication()->runMode();
 
@@ -139,24 +175,24 @@ int AppShell::run(int argc, char** argv)
     // Setup modules: onInit
     // ====================================================
     globalModule.onInit(runMode);
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onInit(runMode);
+    for (mu::modularity::IModuleSetup* m : startupModules) {
+        measureModuleSetup(m, [m, runMode]() { m->onInit(runMode); });
     }
 
     // ====================================================
     // Setup modules: onAllInited
     // ====================================================
     globalModule.onAllInited(runMode);
-    for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onAllInited(runMode);
+    for (mu::modularity::IModuleSetup* m : startupModules) {
+        measureModuleSetup(m, [m, runMode]() { m->onAllInited(runMode); });
     }
 
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
-    QMetaObject::invokeMethod(qApp, [this]() {
+    QMetaObject::invokeMethod(qApp, [startupModules]() {
         globalModule.onStartApp();
-        for (mu::modularity::IModuleSetup* m : m_modules) {
+        for (mu::modularity::IModuleSetup* m : startupModules) {
             m->onStartApp();
         }
     }, Qt::QueuedConnection);
@@ -203,7 +239,7 @@ int AppShell::run(int argc, char** argv)
 #endif
 
         QObject::connect(engine, &QQmlApplicationEngine::objectCreated,
-                         &app, [this, url](QObject* obj, const QUrl& objUrl) {
+                         &app, [startupModules, url](QObject* obj, const QUrl& objUrl) {
                 if (!obj && url == objUrl) {
                     LOGE() << "failed Qml load\n";
                     QCoreApplication::exit(-1);
@@ -215,7 +251,7 @@ int AppShell::run(int argc, char** argv)
                     // ====================================================
 
                     globalModule.onDelayedInit();
-                    for (mu::modularity::IModuleSetup* m : m_modules) {
+                    for (mu::modularity::IModuleSetup* m : startupModules) {
                         m->onDelayedInit();
                     }
                 }
@@ -265,13 +301,13 @@ int AppShell::run(int argc, char** argv)
 
     // Deinit
 
-    for (mu::modularity::IModuleSetup* m : m_modules) {
+    for (mu::modularity::IModuleSetup* m : startupModules) {
         m->onDeinit();
     }
 
     globalModule.onDeinit();
 
-    for (mu::modularity::IModuleSetup* m : m_modules) {
+    for (mu::modularity::IModuleSetup* m : startupModules) {
         m->onDestroy();
     }
 
@@ -292,9 +328,17 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
 
     switch (task.type) {
-    case CommandLineController::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
-        break;
+    case CommandLineController::ConvertType::Batch: {
+        converter::BatchOptions options;
+        options.parallelJobs = task.params.value(CommandLineController::ParamKey::ParallelJobs, 1).toUInt();
+        options.continueOnError = task.params[CommandLineController::ParamKey::ContinueOnError].toBool();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, options);
+    } break;
+    case CommandLineController::ConvertType::Service: {
+        converter::ServiceOptions options;
+        options.memoryLimitMb = task.params[CommandLineController::ParamKey::ServiceMemoryLimit].toUInt();
+        ret = converter()->runService(stylePath, forceMode, options);
+    } break;
     case CommandLineController::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
         break;
@@ -23,6 +23,9 @@
 #ifndef MU_APPSHELL_APPSHELL_H
 #define MU_APPSHELL_APPSHELL_H
 
+#include <map>
+#include <set>
+
 #include <QList>
 
 #include "modularity/imodulesetup.h"
@@ -41,7 +44,14 @@ class AppShell
 public:
     AppShell();
 
-    void addModule(modularity::IModuleSetup* module);
+    //! NOTE EditorOnly modules are set up only when the editor is launched,
+    //! in the converter mode none of their setup methods are called
+    enum class ModuleRunMode {
+        Any,
+        EditorOnly
+    };
+
+    void addModule(modularity::IModuleSetup* module, ModuleRunMode runMode = ModuleRunMode::Any);
 
     int run(int argc, char** argv);
 
@@ -49,7 +59,14 @@ private:
 
     int processConverter(const CommandLineController::ConverterTask& task);
 
+    bool isEditorOnlyModule(const modularity::IModuleSetup* module) const;
+
+    template<typename Func>
+    void measureModuleSetup(const modularity::IModuleSetup* module, const Func& func);
+
     QList<modularity::IModuleSetup*> m_modules;
+    std::set<const modularity::IModuleSetup*> m_editorOnlyModules;
+    std::map<const modularity::IModuleSetup*, std::string> m_modulesProfilerTags;
 };
 }
 
@@ -54,6 +54,14 @@ void CommandLineController::parse(const QStringList& args)
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("parallel-jobs", "Use with '-j <file>', process up to 'count' jobs at the same time. "
+                                                           "Jobs writing audio are processed after the others, the job statuses are printed as the jobs finish",
+                                                           "count"));
+    m_parser.addOption(QCommandLineOption("continue-on-error", "Use with '-j <file>', don't stop the batch at the first failed job"));
+    m_parser.addOption(QCommandLineOption("converter-service",
+                                          "Read conversion jobs as JSON lines from stdin and print the result of each job to stdout"));
+    m_parser.addOption(QCommandLineOption("service-memory-limit",
+                                          "Use with '--converter-service', exit after the job that exceeds 'MB' of resident memory", "MB"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -94,6 +102,25 @@ void CommandLineController::parse(const QStringList& args)
     m_parser.process(args);
 }
 
+IApplication::RunMode CommandLineController::runMode() const
+{
+    static const QStringList CONVERTER_OPTIONS {
+        "o", "j", "converter-service", "score-media", "score-meta", "score-parts", "score-parts-pdf",
+        "score-transpose", "source-update",
+#ifdef BUILD_VIDEOEXPORT_MODULE
+        "score-video",
+#endif
+    };
+
+    for (const QString& option : CONVERTER_OPTIONS) {
+        if (m_parser.isSet(option)) {
+            return IApplication::RunMode::Converter;
+        }
+    }
+
+    return IApplication::RunMode::Editor;
+}
+
 void CommandLineController::apply()
 {
     auto floatValue = [this](const QString& name) -> std::optional<float> {
@@ -174,6 +201,8 @@ void CommandLineController::apply()
     }
 
     // Converter mode
+    application()->setRunMode(runMode());
+
     if (m_parser.isSet("r")) {
         std::optional<float> val = floatValue("r");
         if (val) {
@@ -184,7 +213,6 @@ void CommandLineController::apply()
     }
 
     if (m_parser.isSet("o")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::File;
         if (scorefiles.size() < 1) {
             LOGE() << "Option: -o no input file specified";
@@ -206,13 +234,37 @@ void CommandLineController::apply()
     }
 
     if (m_parser.isSet("j")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = m_parser.value("j");
+
+        if (m_parser.isSet("parallel-jobs")) {
+            std::optional<int> val = intValue("parallel-jobs");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineController::ParamKey::ParallelJobs] = val.value();
+            } else {
+                LOGE() << "Option: --parallel-jobs not recognized count value: " << m_parser.value("parallel-jobs");
+            }
+        }
+
+        if (m_parser.isSet("continue-on-error")) {
+            m_converterTask.params[CommandLineController::ParamKey::ContinueOnError] = true;
+        }
+    }
+
+    if (m_parser.isSet("converter-service")) {
+        m_converterTask.type = ConvertType::Service;
+
+        if (m_parser.isSet("service-memory-limit")) {
+            std::optional<int> val = intValue("service-memory-limit");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineController::ParamKey::ServiceMemoryLimit] = val.value();
+            } else {
+                LOGE() << "Option: --service-memory-limit not recognized MB value: " << m_parser.value("service-memory-limit");
+            }
+        }
     }
 
     if (m_parser.isSet("score-media")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScoreMedia;
         m_converterTask.inputFile = scorefiles[0];
         if (m_parser.isSet("highlight-config")) {
@@ -221,25 +273,21 @@ void CommandLineController::apply()
     }
 
     if (m_parser.isSet("score-meta")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScoreMeta;
         m_converterTask.inputFile = scorefiles[0];
     }
 
     if (m_parser.isSet("score-parts")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScoreParts;
         m_converterTask.inputFile = scorefiles[0];
     }
 
     if (m_parser.isSet("score-parts-pdf")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScorePartsPdf;
         m_converterTask.inputFile = scorefiles[0];
     }
 
     if (m_parser.isSet("score-transpose")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScoreTranspose;
         m_converterTask.inputFile = scorefiles[0];
         m_converterTask.params[CommandLineController::ParamKey::ScoreTransposeOptions] = m_parser.value("score-transpose");
@@ -248,7 +296,6 @@ void CommandLineController::apply()
     if (m_parser.isSet("source-update")) {
         QStringList args = m_parser.positionalArguments();
 
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::SourceUpdate;
         m_converterTask.inputFile = args[0];
 
@@ -262,7 +309,6 @@ void CommandLineController::apply()
     // Video
 #ifdef BUILD_VIDEOEXPORT_MODULE
     if (m_parser.isSet("score-video")) {
-        application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScoreVideo;
         m_converterTask.inputFile = scorefiles[0];
         m_converterTask.outputFile = m_parser.value("o");
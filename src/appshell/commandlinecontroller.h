@@ -57,6 +57,7 @@ public:
     enum class ConvertType {
         File,
         Batch,
+        Service,
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
@@ -74,6 +75,13 @@ public:
         ScoreTransposeOptions,
         ForceMode,
 
+        // Batch
+        ParallelJobs,
+        ContinueOnError,
+
+        // Service
+        ServiceMemoryLimit,
+
         // Video
     };
 
@@ -89,6 +97,9 @@ public:
     void parse(const QStringList& args);
     void apply();
 
+    //! NOTE Known right after parse, before the modules are set up
+    framework::IApplication::RunMode runMode() const;
+
     ConverterTask converterTask() const;
 
 private:
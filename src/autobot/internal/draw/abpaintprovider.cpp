@@ -99,7 +99,12 @@ void AbPaintProvider::paintData(draw::IPaintProviderPtr provider, const draw::Dr
             }
 
             for (const DrawText& t : d.texts) {
-                provider->drawText(t.pos, t.text);
+                std::u32string ucs4 = t.isSymbol ? t.text.toStdU32String() : std::u32string();
+                if (ucs4.size() == 1) {
+                    provider->drawSymbol(t.pos, ucs4.front());
+                } else {
+                    provider->drawText(t.pos, t.text);
+                }
             }
 
             for (const DrawRectText& t : d.rectTexts) {
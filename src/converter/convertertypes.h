@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_CONVERTERTYPES_H
+#define MU_CONVERTER_CONVERTERTYPES_H
+
+#include <cstddef>
+
+namespace mu::converter {
+struct BatchOptions
+{
+    //! NOTE Number of jobs processed at the same time, each in its own thread and project
+    size_t parallelJobs = 1;
+
+    //! NOTE By default, the batch stops at the first failed job
+    bool continueOnError = false;
+};
+
+struct ServiceOptions
+{
+    //! NOTE When the resident memory exceeds this limit after a request, the service stops,
+    //! so that the supervisor can start a fresh instance. 0 means no limit
+    size_t memoryLimitMb = 0;
+};
+}
+
+#endif // MU_CONVERTER_CONVERTERTYPES_H
@@ -26,6 +26,8 @@
 #include "types/ret.h"
 #include "io/path.h"
 
+#include "convertertypes.h"
+
 namespace mu::converter {
 class IConverterController : MODULE_EXPORT_INTERFACE
 {
@@ -35,7 +37,10 @@ public:
 
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                             const BatchOptions& options = BatchOptions()) = 0;
+    virtual Ret runService(const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                           const ServiceOptions& options = ServiceOptions()) = 0;
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
@@ -21,6 +21,16 @@
  */
 #include "convertercontroller.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <QCoreApplication>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -28,8 +38,13 @@
 #include <QJsonParseError>
 
 #include "convertercodes.h"
+#include "containers.h"
 #include "stringutils.h"
+#include "runtime.h"
 #include "compat/backendapi.h"
+#include "compat/notationmeta.h"
+
+#include "engraving/libmscore/mscore.h"
 
 #include "log.h"
 
@@ -39,8 +54,68 @@ using namespace mu::notation;
 
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
+static const std::string META_JSON_SUFFIX = "metajson";
 
-mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
+//! NOTE The calls of the workers made on the main thread, it processes them while waiting for the workers
+class MainThreadCalls
+{
+public:
+    MainThreadCalls(size_t workersCount)
+        : m_workersCount(workersCount) {}
+
+    void call(const std::function<void()>& func)
+    {
+        bool done = false;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_calls.push_back({ &func, &done });
+        m_condition.notify_all();
+        m_condition.wait(lock, [&done]() { return done; });
+    }
+
+    void workerFinished()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_finishedWorkers;
+        m_condition.notify_all();
+    }
+
+    void processUntilWorkersFinished()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_condition.wait(lock, [this]() { return !m_calls.empty() || m_finishedWorkers == m_workersCount; });
+            if (m_calls.empty()) {
+                return;
+            }
+
+            Call c = m_calls.front();
+            m_calls.pop_front();
+
+            lock.unlock();
+            (*c.func)();
+            lock.lock();
+
+            *c.done = true;
+            m_condition.notify_all();
+        }
+    }
+
+private:
+    struct Call {
+        const std::function<void()>* func = nullptr;
+        bool* done = nullptr;
+    };
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<Call> m_calls;
+    size_t m_workersCount = 0;
+    size_t m_finishedWorkers = 0;
+};
+
+mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode,
+                                          const BatchOptions& options)
 {
     TRACEFUNC;
 
@@ -50,48 +125,411 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
-    Ret ret = make_ret(Ret::Code::Ok);
-    for (const Job& job : batchJob.val) {
-        ret = fileConvert(job.in, job.out, stylePath, forceMode);
+    if (options.parallelJobs > 1 && batchJob.val.size() > 1) {
+        return convertBatchConcurrently(batchJob.val, stylePath, forceMode, options);
+    }
+
+    return convertBatchSerially(batchJob.val, stylePath, forceMode, options);
+}
+
+mu::Ret ConverterController::runService(const io::path_t& stylePath, bool forceMode, const ServiceOptions& options)
+{
+    TRACEFUNC;
+
+    LOGI() << "converter service started, memory limit: " << options.memoryLimitMb << " MB";
+
+    //! NOTE One request per line, a request is a batch job object: {"id": ..., "in": ..., "out": ...}
+    //! The result of each request is written as one line to stdout
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        QJsonParseError err;
+        QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+
+        RetVal<Job> job;
+        if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+            job.ret = make_ret(Err::ServiceRequestFailedParse, err.errorString().toStdString());
+        } else {
+            job = parseJob(doc.object());
+        }
+
+        if (!job.ret) {
+            printJobResult(job.val, job.ret, 0, 0);
+            continue;
+        }
+
+        convertJob(job.val, stylePath, forceMode, true);
+
+        //! NOTE Let the main thread process the notifications queued during the conversion
+        QCoreApplication::processEvents();
+
+        size_t memoryMb = runtime::residentMemorySize() / (1024 * 1024);
+        if (options.memoryLimitMb > 0 && memoryMb > options.memoryLimitMb) {
+            QJsonObject obj;
+            obj["event"] = "recycle";
+            obj["memoryMb"] = static_cast<qint64>(memoryMb);
+            printJson(obj);
+
+            LOGI() << "converter service stopped, memory: " << memoryMb << " MB, limit: " << options.memoryLimitMb << " MB";
+            return make_ret(Ret::Code::Ok);
+        }
+    }
+
+    LOGI() << "converter service stopped, end of input";
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::convertBatchSerially(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode,
+                                                  const BatchOptions& options)
+{
+    Ret result = make_ret(Ret::Code::Ok);
+    for (const Job& job : batchJob) {
+        Ret ret = convertJob(job, stylePath, forceMode, true);
         if (!ret) {
-            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
+            if (result) {
+                result = ret;
+            }
+
+            if (!options.continueOnError) {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+mu::Ret ConverterController::convertBatchConcurrently(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode,
+                                                      const BatchOptions& options)
+{
+    TRACEFUNC;
+
+    //! NOTE Some writers (for example, audio) depend on the current project and the playback,
+    //! so such jobs are processed on the main thread after the concurrent ones.
+    //! So the jobs aren't processed in the order of the batch file, each job status has its "in" (and "id") to match it
+    std::vector<const Job*> concurrentJobs;
+    std::vector<const Job*> mainThreadJobs;
+    for (const Job& job : batchJob) {
+        if (isConvertConcurrently(job)) {
+            concurrentJobs.push_back(&job);
+        } else {
+            mainThreadJobs.push_back(&job);
+        }
+    }
+
+    std::atomic<size_t> nextJob = 0;
+    std::atomic<bool> stopped = false;
+    std::mutex resultMutex;
+    Ret result = make_ret(Ret::Code::Ok);
+
+    size_t workersCount = std::min(options.parallelJobs, concurrentJobs.size());
+    LOGI() << "concurrent jobs: " << concurrentJobs.size() << ", main thread jobs: " << mainThreadJobs.size()
+           << ", workers: " << workersCount;
+
+    MainThreadCalls mainThreadCalls(workersCount);
+    MainThreadCall mainThreadCall = [&mainThreadCalls](const std::function<void()>& func) {
+        mainThreadCalls.call(func);
+    };
+
+    //! NOTE The painting values are per thread (see MScore::pixelRatio), and they affect the layout
+    engraving::MScore::PaintingState paintingState = engraving::MScore::paintingState();
+
+    auto worker = [&](size_t workerNum) {
+        runtime::setThreadName("converter_worker_" + std::to_string(workerNum));
+        engraving::MScore::setPaintingState(paintingState);
+
+        while (!stopped) {
+            size_t idx = nextJob++;
+            if (idx >= concurrentJobs.size()) {
+                break;
+            }
+
+            Ret ret = convertJob(*concurrentJobs.at(idx), stylePath, forceMode, false, mainThreadCall);
+            if (!ret) {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (result) {
+                    result = ret;
+                }
+
+                if (!options.continueOnError) {
+                    stopped = true;
+                }
+            }
+        }
+
+        mainThreadCalls.workerFinished();
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount);
+    for (size_t i = 0; i < workersCount; ++i) {
+        workers.emplace_back(worker, i);
+    }
+
+    mainThreadCalls.processUntilWorkersFinished();
+
+    for (std::thread& th : workers) {
+        th.join();
+    }
+
+    for (const Job* job : mainThreadJobs) {
+        if (stopped) {
             break;
         }
+
+        Ret ret = convertJob(*job, stylePath, forceMode, true);
+        if (!ret) {
+            if (result) {
+                result = ret;
+            }
+
+            if (!options.continueOnError) {
+                stopped = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+mu::Ret ConverterController::convertJob(const Job& job, const io::path_t& stylePath, bool forceMode, bool setAsCurrentProject,
+                                        const MainThreadCall& mainThreadCall)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    int64_t loadMsecs = 0;
+    Ret ret = doConvertJob(job, stylePath, forceMode, setAsCurrentProject, &loadMsecs, mainThreadCall);
+
+    auto msecs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    printJobResult(job, ret, loadMsecs, msecs);
+
+    if (!ret) {
+        LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in;
     }
 
     return ret;
 }
 
+void ConverterController::printJobResult(const Job& job, const Ret& ret, int64_t loadMsecs, int64_t totalMsecs) const
+{
+    QJsonArray out;
+    for (const io::path_t& path : job.out) {
+        out.append(path.toQString());
+    }
+
+    for (const PartsOutput& partsOut : job.partsOut) {
+        out.append(QJsonArray { partsOut.prefix.toQString(), partsOut.suffix.toQString() });
+    }
+
+    QJsonObject obj;
+    if (!job.id.empty()) {
+        obj["id"] = QString::fromStdString(job.id);
+    }
+    obj["in"] = job.in.toQString();
+    obj["out"] = out;
+    obj["status"] = ret ? "ok" : "failed";
+    if (!ret) {
+        obj["error"] = QString::fromStdString(ret.toString());
+    }
+    obj["loadTimeMs"] = static_cast<qint64>(loadMsecs);
+    obj["timeMs"] = static_cast<qint64>(totalMsecs);
+
+    printJson(obj);
+}
+
+void ConverterController::printJson(const QJsonObject& obj) const
+{
+    QByteArray line = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+
+    //! NOTE One line per object, the lines of different workers must not interleave
+    static std::mutex printMutex;
+    std::lock_guard<std::mutex> lock(printMutex);
+    fprintf(stdout, "%s\n", line.constData());
+    fflush(stdout);
+}
+
+bool ConverterController::isConvertConcurrently(const Job& job) const
+{
+    static const std::set<std::string> MAIN_THREAD_ONLY_SUFFIXES {
+        "wav", "mp3", "ogg", "flac"
+    };
+
+    for (const io::path_t& out : job.out) {
+        if (mu::contains(MAIN_THREAD_ONLY_SUFFIXES, io::suffix(out))) {
+            return false;
+        }
+    }
+
+    for (const PartsOutput& out : job.partsOut) {
+        if (mu::contains(MAIN_THREAD_ONLY_SUFFIXES, io::suffix(out.suffix))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
+{
+    Job job;
+    job.in = in;
+    job.out.push_back(out);
+
+    return doConvertJob(job, stylePath, forceMode, true);
+}
+
+mu::Ret ConverterController::doConvertJob(const Job& job, const io::path_t& stylePath, bool forceMode, bool setAsCurrentProject,
+                                          int64_t* loadMsecs, const MainThreadCall& mainThreadCall)
 {
     TRACEFUNC;
 
-    LOGI() << "in: " << in << ", out: " << out;
-    auto notationProject = notationCreator()->newProject();
+    LOGI() << "in: " << job.in << ", outputs: " << job.out.size() + job.partsOut.size();
+
+    //! NOTE Check all outputs before loading, so as not to load the input in vain
+    for (const io::path_t& out : job.out) {
+        std::string suffix = io::suffix(out);
+        if (suffix != META_JSON_SUFFIX && !writers()->writer(suffix)) {
+            return make_ret(Err::ConvertTypeUnknown);
+        }
+    }
+
+    for (const PartsOutput& out : job.partsOut) {
+        if (!writers()->writer(io::suffix(out.suffix))) {
+            return make_ret(Err::ConvertTypeUnknown);
+        }
+    }
+
+    auto onMainThread = [&mainThreadCall](const std::function<void()>& func) {
+        if (mainThreadCall) {
+            mainThreadCall(func);
+        } else {
+            func();
+        }
+    };
+
+    INotationProjectPtr notationProject = notationCreator()->newProject();
     IF_ASSERT_FAILED(notationProject) {
         return make_ret(Err::UnknownError);
     }
 
+    auto loadStart = std::chrono::steady_clock::now();
+
+    Ret ret = notationProject->loadScore(job.in, stylePath, forceMode);
+    if (!ret) {
+        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << job.in;
+        return make_ret(Err::InFileFailedLoad);
+    }
+
+    //! NOTE The notation subscribes to the app channels, so it's made and released on the main thread,
+    //! only the score is read and laid out on a worker thread
+    onMainThread([&]() {
+        ret = notationProject->setupLoadedScore();
+    });
+
+    if (ret) {
+        if (loadMsecs) {
+            *loadMsecs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - loadStart).count();
+        }
+
+        if (setAsCurrentProject) {
+            globalContext()->setCurrentProject(notationProject);
+        }
+
+        ret = writeJobOutputs(job, notationProject);
+    } else {
+        LOGE() << "failed setup notation, err: " << ret.toString() << ", path: " << job.in;
+        ret = make_ret(Err::InFileFailedLoad);
+    }
+
+    onMainThread([&]() {
+        notationProject = nullptr;
+    });
+
+    return ret;
+}
+
+mu::Ret ConverterController::writeJobOutputs(const Job& job, INotationProjectPtr notationProject)
+{
+    //! NOTE The outputs are independent, so a failed one doesn't prevent writing the others
+    Ret result = make_ret(Ret::Code::Ok);
+
+    IMasterNotationPtr masterNotation = notationProject->masterNotation();
+    for (const io::path_t& out : job.out) {
+        Ret ret = convertScoreOutput(masterNotation->notation(), out);
+        if (!ret && result) {
+            result = ret;
+        }
+    }
+
+    for (const PartsOutput& out : job.partsOut) {
+        Ret ret = convertPartsOutput(masterNotation, out);
+        if (!ret && result) {
+            result = ret;
+        }
+    }
+
+    return result;
+}
+
+mu::Ret ConverterController::convertScoreOutput(INotationPtr notation, const io::path_t& out) const
+{
+    TRACEFUNC;
+
     std::string suffix = io::suffix(out);
+    if (suffix == META_JSON_SUFFIX) {
+        return writeScoreMeta(notation, out);
+    }
+
     auto writer = writers()->writer(suffix);
     if (!writer) {
         return make_ret(Err::ConvertTypeUnknown);
     }
 
-    Ret ret = notationProject->load(in, stylePath, forceMode);
-    if (!ret) {
-        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
-        return make_ret(Err::InFileFailedLoad);
+    if (isConvertPageByPage(suffix)) {
+        return convertPageByPage(writer, notation, out);
     }
 
-    globalContext()->setCurrentProject(notationProject);
+    return convertFullNotation(writer, notation, out);
+}
 
-    if (isConvertPageByPage(suffix)) {
-        ret = convertPageByPage(writer, notationProject->masterNotation()->notation(), out);
-    } else {
-        ret = convertFullNotation(writer, notationProject->masterNotation()->notation(), out);
+mu::Ret ConverterController::convertPartsOutput(IMasterNotationPtr masterNotation, const PartsOutput& out) const
+{
+    TRACEFUNC;
+
+    for (IExcerptNotationPtr excerpt : masterNotation->excerpts().val) {
+        io::path_t path = out.prefix + excerpt->name() + out.suffix;
+
+        Ret ret = convertScoreOutput(excerpt->notation(), path);
+        if (!ret) {
+            return ret;
+        }
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::writeScoreMeta(INotationPtr notation, const io::path_t& out) const
+{
+    RetVal<std::string> meta = NotationMeta::metaJson(notation);
+    if (!meta.ret) {
+        return meta.ret;
     }
 
+    QFile file(out.toQString());
+    if (!file.open(QFile::WriteOnly)) {
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    if (file.write(QByteArray::fromStdString(meta.val)) < 0) {
+        return make_ret(Err::OutFileFailedWrite);
+    }
+
+    file.close();
+
     return make_ret(Ret::Code::Ok);
 }
 
@@ -150,15 +588,50 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     QJsonArray arr = doc.array();
 
     for (const QJsonValue v : arr) {
-        QJsonObject obj = v.toObject();
+        RetVal<Job> job = parseJob(v);
+        if (job.ret) {
+            rv.val.push_back(std::move(job.val));
+        }
+    }
 
-        Job job;
-        job.in = obj["in"].toString();
-        job.out = obj["out"].toString();
+    rv.ret = make_ret(Ret::Code::Ok);
+    return rv;
+}
 
-        if (!job.in.empty() && !job.out.empty()) {
-            rv.val.push_back(std::move(job));
+mu::RetVal<ConverterController::Job> ConverterController::parseJob(const QJsonValue& value) const
+{
+    //! NOTE `out` is either a single path, or a list of outputs for the same input,
+    //! where an output is a path or a pair [prefix, suffix] to write each part separately
+    auto appendOutput = [](Job& job, const QJsonValue& out) {
+        if (out.isString()) {
+            job.out.push_back(out.toString());
+            return;
         }
+
+        QJsonArray pair = out.toArray();
+        if (pair.size() == 2) {
+            job.partsOut.push_back({ pair.at(0).toString(), pair.at(1).toString() });
+        }
+    };
+
+    QJsonObject obj = value.toObject();
+
+    RetVal<Job> rv;
+    rv.val.id = obj["id"].toVariant().toString().toStdString();
+    rv.val.in = obj["in"].toString();
+
+    QJsonValue out = obj["out"];
+    if (out.isArray()) {
+        for (const QJsonValue o : out.toArray()) {
+            appendOutput(rv.val, o);
+        }
+    } else {
+        appendOutput(rv.val, out);
+    }
+
+    if (rv.val.in.empty() || (rv.val.out.empty() && rv.val.partsOut.empty())) {
+        rv.ret = make_ret(Err::ServiceRequestFailedParse, "no input or output");
+        return rv;
     }
 
     rv.ret = make_ret(Ret::Code::Ok);
@@ -178,29 +651,43 @@ mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotat
 {
     TRACEFUNC;
 
-    for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
+    auto start = std::chrono::steady_clock::now();
+
+    size_t pageCount = notation->elements()->pages().size();
+
+    std::vector<std::unique_ptr<QFile> > files;
+    std::vector<QIODevice*> devices;
+    files.reserve(pageCount);
+    devices.reserve(pageCount);
+
+    for (size_t i = 0; i < pageCount; i++) {
         const QString filePath = io::path_t(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
 
-        QFile file(filePath);
-        if (!file.open(QFile::WriteOnly)) {
+        auto file = std::make_unique<QFile>(filePath);
+        if (!file->open(QFile::WriteOnly)) {
             return make_ret(Err::OutFileFailedOpen);
         }
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        file->setProperty("path", out.toQString());
 
-        file.setProperty("path", out.toQString());
+        devices.push_back(file.get());
+        files.push_back(std::move(file));
+    }
 
-        Ret ret = writer->write(notation, file, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
-            return make_ret(Err::OutFileFailedWrite);
-        }
+    //! NOTE Writers may process the pages concurrently (ex. png)
+    Ret ret = writer->writePages(notation, devices);
+    if (!ret) {
+        LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
+        return make_ret(Err::OutFileFailedWrite);
+    }
 
-        file.close();
+    for (std::unique_ptr<QFile>& file : files) {
+        file->close();
     }
 
+    LOGI() << "pages: " << pageCount << ", path: " << out << ", time: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() << " ms";
+
     return make_ret(Ret::Code::Ok);
 }
 
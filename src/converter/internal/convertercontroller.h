@@ -22,7 +22,8 @@
 #ifndef MU_CONVERTER_CONVERTERCONTROLLER_H
 #define MU_CONVERTER_CONVERTERCONTROLLER_H
 
-#include <list>
+#include <functional>
+#include <vector>
 
 #include "../iconvertercontroller.h"
 
@@ -34,6 +35,9 @@
 
 #include "types/retval.h"
 
+class QJsonObject;
+class QJsonValue;
+
 namespace mu::converter {
 class ConverterController : public IConverterController
 {
@@ -47,7 +51,10 @@ public:
 
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
-    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                     const BatchOptions& options = BatchOptions()) override;
+    Ret runService(const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                   const ServiceOptions& options = ServiceOptions()) override;
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -69,14 +76,42 @@ public:
 
 private:
 
+    //! NOTE Each part (excerpt) is written to `prefix + part name + suffix`
+    struct PartsOutput {
+        io::path_t prefix;
+        io::path_t suffix;
+    };
+
+    //! NOTE The input is loaded and laid out once for all its outputs
     struct Job {
+        std::string id;
         io::path_t in;
-        io::path_t out;
+        io::paths_t out;
+        std::vector<PartsOutput> partsOut;
     };
 
-    using BatchJob = std::list<Job>;
+    using BatchJob = std::vector<Job>;
+
+    //! NOTE Makes the call on the main thread and waits for it, empty means the current thread is the main one
+    using MainThreadCall = std::function<void (const std::function<void()>&)>;
 
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
+    RetVal<Job> parseJob(const QJsonValue& value) const;
+
+    Ret convertBatchSerially(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode, const BatchOptions& options);
+    Ret convertBatchConcurrently(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode, const BatchOptions& options);
+    Ret convertJob(const Job& job, const io::path_t& stylePath, bool forceMode, bool setAsCurrentProject,
+                   const MainThreadCall& mainThreadCall = nullptr);
+    void printJobResult(const Job& job, const Ret& ret, int64_t loadMsecs, int64_t totalMsecs) const;
+    void printJson(const QJsonObject& obj) const;
+
+    bool isConvertConcurrently(const Job& job) const;
+    Ret doConvertJob(const Job& job, const io::path_t& stylePath, bool forceMode, bool setAsCurrentProject, int64_t* loadMsecs = nullptr,
+                     const MainThreadCall& mainThreadCall = nullptr);
+    Ret writeJobOutputs(const Job& job, project::INotationProjectPtr notationProject);
+    Ret convertScoreOutput(notation::INotationPtr notation, const io::path_t& out) const;
+    Ret convertPartsOutput(notation::IMasterNotationPtr masterNotation, const PartsOutput& out) const;
+    Ret writeScoreMeta(notation::INotationPtr notation, const io::path_t& out) const;
 
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
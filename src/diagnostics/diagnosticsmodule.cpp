@@ -32,6 +32,7 @@
 #include "internal/diagnosticsactions.h"
 #include "internal/diagnosticsactionscontroller.h"
 #include "internal/diagnosticspathsregister.h"
+#include "internal/diagnosticsframesregister.h"
 #include "internal/engravingelementsprovider.h"
 
 #include "internal/crashhandler/crashhandler.h"
@@ -68,6 +69,7 @@ std::string DiagnosticsModule::moduleName() const
 void DiagnosticsModule::registerExports()
 {
     ioc()->registerExport<IDiagnosticsPathsRegister>(moduleName(), new DiagnosticsPathsRegister());
+    ioc()->registerExport<IDiagnosticsFramesRegister>(moduleName(), new DiagnosticsFramesRegister());
     ioc()->registerExport<EngravingElementsProvider>(moduleName(), new EngravingElementsProvider());
 }
 
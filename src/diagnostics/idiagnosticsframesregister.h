@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_IDIAGNOSTICSFRAMESREGISTER_H
+#define MU_DIAGNOSTICS_IDIAGNOSTICSFRAMESREGISTER_H
+
+#include <string>
+#include <vector>
+
+#include "modularity/imoduleexport.h"
+
+namespace mu::diagnostics {
+//! NOTE Frame times of the views (and their background jobs), shown in the profiler view
+class IDiagnosticsFramesRegister : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IDiagnosticsFramesRegister)
+public:
+    virtual ~IDiagnosticsFramesRegister() = default;
+
+    struct Stats
+    {
+        std::string name;
+        size_t count = 0;
+        double lastMs = 0.0;
+        double avgMs = 0.0;
+        double p95Ms = 0.0; // of the recent frames
+        double maxMs = 0.0;
+    };
+
+    //! NOTE Can be called from any thread
+    virtual void addFrame(const std::string& name, double ms) = 0;
+
+    virtual std::vector<Stats> stats() const = 0;
+    virtual void clear() = 0;
+};
+}
+
+#endif // MU_DIAGNOSTICS_IDIAGNOSTICSFRAMESREGISTER_H
@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "diagnosticsframesregister.h"
+
+#include <algorithm>
+
+using namespace mu::diagnostics;
+
+static constexpr size_t RECENT_FRAMES = 256;
+
+void DiagnosticsFramesRegister::addFrame(const std::string& name, double ms)
+{
+    std::lock_guard lock(m_mutex);
+
+    Frames& frames = m_frames[name];
+    if (frames.recent.size() < RECENT_FRAMES) {
+        frames.recent.push_back(ms);
+    } else {
+        frames.recent[frames.count % RECENT_FRAMES] = ms;
+    }
+
+    frames.count++;
+    frames.totalMs += ms;
+    frames.lastMs = ms;
+    frames.maxMs = std::max(frames.maxMs, ms);
+}
+
+std::vector<IDiagnosticsFramesRegister::Stats> DiagnosticsFramesRegister::stats() const
+{
+    std::lock_guard lock(m_mutex);
+
+    std::vector<Stats> result;
+    result.reserve(m_frames.size());
+    for (const auto& pair : m_frames) {
+        const Frames& frames = pair.second;
+
+        Stats s;
+        s.name = pair.first;
+        s.count = frames.count;
+        s.lastMs = frames.lastMs;
+        s.avgMs = frames.count > 0 ? frames.totalMs / frames.count : 0.0;
+        s.maxMs = frames.maxMs;
+
+        if (!frames.recent.empty()) {
+            std::vector<double> sorted = frames.recent;
+            size_t p95 = (sorted.size() * 95) / 100;
+            std::nth_element(sorted.begin(), sorted.begin() + p95, sorted.end());
+            s.p95Ms = sorted.at(p95);
+        }
+
+        result.push_back(std::move(s));
+    }
+
+    return result;
+}
+
+void DiagnosticsFramesRegister::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_frames.clear();
+}
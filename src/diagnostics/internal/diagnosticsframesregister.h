@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_DIAGNOSTICSFRAMESREGISTER_H
+#define MU_DIAGNOSTICS_DIAGNOSTICSFRAMESREGISTER_H
+
+#include <map>
+#include <mutex>
+
+#include "../idiagnosticsframesregister.h"
+
+namespace mu::diagnostics {
+class DiagnosticsFramesRegister : public IDiagnosticsFramesRegister
+{
+public:
+    DiagnosticsFramesRegister() = default;
+
+    void addFrame(const std::string& name, double ms) override;
+
+    std::vector<Stats> stats() const override;
+    void clear() override;
+
+private:
+
+    struct Frames
+    {
+        size_t count = 0;
+        double totalMs = 0.0;
+        double lastMs = 0.0;
+        double maxMs = 0.0;
+        std::vector<double> recent; // ring buffer
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, Frames> m_frames;
+};
+}
+
+#endif // MU_DIAGNOSTICS_DIAGNOSTICSFRAMESREGISTER_H
@@ -26,6 +26,7 @@
 #include "engraving/libmscore/engravingobject.h"
 #include "engraving/libmscore/score.h"
 #include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/undo.h"
 #include "dataformatter.h"
 
 #include "log.h"
@@ -354,6 +355,21 @@ void EngravingElementsModel::updateInfo()
         m_summary.clear();
         QTextStream stream(&m_summary);
         stream << "Total: " << elements.size();
+
+        for (const mu::engraving::EngravingObject* el : elements) {
+            if (!el->isScore() || !mu::engraving::toScore(el)->isMaster()) {
+                continue;
+            }
+
+            const mu::engraving::Score* score = mu::engraving::toScore(el);
+            const mu::engraving::UndoStack* undo = score->undoStack();
+            stream << "\nUndo (" << score->name().toQString() << "): "
+                   << undo->stepCount() << " steps, "
+                   << (undo->memoryUsage() / 1024) << " KB";
+            if (undo->memoryBudget() > 0) {
+                stream << " of " << (undo->memoryBudget() / 1024) << " KB";
+            }
+        }
     }
 
     emit infoChanged();
@@ -88,6 +88,23 @@ void ProfilerViewModel::reload()
         m_allList.append(item);
     }
 
+    if (framesRegister()) {
+        group = "Frames";
+        for (const IDiagnosticsFramesRegister::Stats& s : framesRegister()->stats()) {
+            Item item;
+            item.group = group;
+            item.data = QString("%1: count: %2, last: %3 ms, avg: %4 ms, p95: %5 ms, max: %6 ms")
+                        .arg(QString::fromStdString(s.name))
+                        .arg(s.count)
+                        .arg(s.lastMs, 0, 'f', 2)
+                        .arg(s.avgMs, 0, 'f', 2)
+                        .arg(s.p95Ms, 0, 'f', 2)
+                        .arg(s.maxMs, 0, 'f', 2);
+
+            m_allList.append(item);
+        }
+    }
+
     find(m_searchText);
 }
 
@@ -114,6 +131,9 @@ void ProfilerViewModel::find(const QString& str)
 void ProfilerViewModel::clear()
 {
     PROFILER_CLEAR;
+    if (framesRegister()) {
+        framesRegister()->clear();
+    }
     reload();
 }
 
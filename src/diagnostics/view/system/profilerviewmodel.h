@@ -24,10 +24,16 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "../../idiagnosticsframesregister.h"
+
 namespace mu::diagnostics {
 class ProfilerViewModel : public QAbstractListModel
 {
     Q_OBJECT
+
+    INJECT(diagnostics, IDiagnosticsFramesRegister, framesRegister)
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
 
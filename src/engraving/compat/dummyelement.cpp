@@ -55,17 +55,10 @@ DummyElement::~DummyElement()
 
 void DummyElement::init()
 {
-#ifndef ENGRAVING_NO_ACCESSIBILITY
-    setupAccessible();
-#endif
-
+    //! NOTE The accessible items are made on demand (see RootItem::init)
     m_root = new RootItem(score());
     m_root->setParent(explicitParent());
 
-#ifndef ENGRAVING_NO_ACCESSIBILITY
-    m_root->setupAccessible();
-#endif
-
     m_page = Factory::createPage(m_root);
     m_page->setParent(explicitParent());
 
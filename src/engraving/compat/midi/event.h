@@ -175,6 +175,7 @@ class EventMap : public std::multimap<int, NPlayEvent>
     int _highestChannel = 15;
 public:
     void fixupMIDI();
+    int highestChannel() const { return _highestChannel; }
     void registerChannel(int c)
     {
         if (c > _highestChannel) {
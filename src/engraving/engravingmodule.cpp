@@ -27,6 +27,8 @@
 #include "draw/ifontprovider.h"
 #include "infrastructure/smufl.h"
 #include "infrastructure/symbolfonts.h"
+#include "layout/segmentdistancecache.h"
+#include "layout/textlayoutcache.h"
 
 #ifndef ENGRAVING_NO_INTERNAL
 #include "internal/engravingconfiguration.h"
@@ -104,6 +106,10 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
 
         SymbolFonts::setFallbackFont(u"Bravura");
 
+        //! NOTE The default and the fallback fonts are needed by the palette score below and by the first score,
+        //! let's load them while the text fonts and the styles are set up
+        SymbolFonts::loadInBackground({ u"Leland", u"Bravura" });
+
         // Text
         const std::vector<io::path_t> textFonts = {
             ":/fonts/musejazz/MuseJazzText.otf",
@@ -147,6 +153,8 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
         fontProvider->insertSubstitution(u"Finale Maestro Text", u"Leland Text");
         fontProvider->insertSubstitution(u"Finale Broadway Text", u"MuseJazz Text");
         fontProvider->insertSubstitution(u"ScoreFont",      u"Leland Text");// alias for current Musical Text Font
+
+        TextLayoutCache::instance()->invalidate();
     }
 
 #ifndef ENGRAVING_NO_INTERNAL
@@ -187,6 +195,19 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
     //! NOTE And some initialization in the `Notation::init()`
 }
 
+void EngravingModule::onDeinit()
+{
+    SymbolFonts::waitBackgroundLoad();
+
+    TextLayoutCache::Stats stats = TextLayoutCache::instance()->stats();
+    LOGI() << "text layout cache, hits: " << stats.hits << ", misses: " << stats.misses << ", hit rate: " << stats.hitRate()
+           << ", invalidations: " << stats.invalidations;
+
+    SegmentDistanceCache::Stats distanceStats = SegmentDistanceCache::stats();
+    LOGI() << "segment distance cache, hits: " << distanceStats.hits << ", misses: " << distanceStats.misses
+           << ", hit rate: " << distanceStats.hitRate();
+}
+
 void EngravingModule::onDestroy()
 {
     delete gpaletteScore;
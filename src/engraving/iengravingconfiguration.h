@@ -85,6 +85,10 @@ public:
     virtual async::Notification debuggingOptionsChanged() const = 0;
 
     virtual bool isAccessibleEnabled() const = 0;
+
+    //! NOTE In bytes, 0 - unlimited
+    virtual size_t undoMemoryBudget() const = 0;
+    virtual async::Channel<size_t> undoMemoryBudgetChanged() const = 0;
 };
 }
 
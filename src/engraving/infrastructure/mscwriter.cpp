@@ -28,6 +28,7 @@
 #include "io/file.h"
 #include "io/fileinfo.h"
 #include "io/dir.h"
+#include "serialization/xmlbinary.h"
 #include "serialization/xmlstreamwriter.h"
 #include "serialization/zipwriter.h"
 #include "serialization/textstream.h"
@@ -38,6 +39,18 @@ using namespace mu;
 using namespace mu::io;
 using namespace mu::engraving;
 
+//! NOTE If the xml can't be converted, the text is stored, the reader accepts both
+static ByteArray toBinaryXml(const ByteArray& data)
+{
+    ByteArray binary = XmlBinary::fromXml(data);
+    if (binary.empty() && !data.empty()) {
+        LOGE() << "failed convert to binary xml, will be stored as text";
+        return data;
+    }
+
+    return binary;
+}
+
 MscWriter::MscWriter(const Params& params)
     : m_params(params)
 {
@@ -149,7 +162,7 @@ String MscWriter::mainFileName() const
 
 void MscWriter::writeScoreFile(const ByteArray& data)
 {
-    addFileData(mainFileName(), data);
+    addFileData(mainFileName(), m_params.binaryXml ? toBinaryXml(data) : data);
 }
 
 void MscWriter::addExcerptStyleFile(const String& name, const ByteArray& data)
@@ -161,7 +174,7 @@ void MscWriter::addExcerptStyleFile(const String& name, const ByteArray& data)
 void MscWriter::addExcerptFile(const String& name, const ByteArray& data)
 {
     String fileName = name + u".mscx";
-    addFileData(u"Excerpts/" + fileName, data);
+    addFileData(u"Excerpts/" + fileName, m_params.binaryXml ? toBinaryXml(data) : data);
 }
 
 void MscWriter::writeChordListFile(const ByteArray& data)
@@ -43,6 +43,10 @@ public:
         io::path_t filePath;
         String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE Store the score and excerpts in the binary xml format (see XmlBinary).
+        //! Used only for internal snapshots, which are read faster than the text format
+        bool binaryXml = false;
     };
 
     MscWriter() = default;
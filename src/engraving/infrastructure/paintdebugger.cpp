@@ -184,6 +184,11 @@ void PaintDebugger::drawSymbol(const PointF& point, char32_t ucs4Code)
     m_real->drawSymbol(point, ucs4Code);
 }
 
+void PaintDebugger::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    m_real->drawSymbols(points, ucs4Codes, count);
+}
+
 void PaintDebugger::drawPixmap(const PointF& p, const Pixmap& pm)
 {
     m_real->drawPixmap(p, pm);
@@ -69,6 +69,7 @@ public:
     void drawTextWorkaround(const draw::Font& f, const PointF& pos, const String& text) override;
 
     void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
 
     void drawPixmap(const PointF& p, const draw::Pixmap& pm) override;
     void drawTiledPixmap(const RectF& rect, const draw::Pixmap& pm, const PointF& offset = PointF()) override;
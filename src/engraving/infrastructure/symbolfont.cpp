@@ -21,13 +21,18 @@
  */
 #include "symbolfont.h"
 
+#include <chrono>
+#include <cstring>
+
 #include "serialization/json.h"
 #include "io/file.h"
 #include "io/fileinfo.h"
 #include "draw/painter.h"
 #include "types/symnames.h"
+#include "version.h"
 
 #include "libmscore/mscore.h"
+#include "layout/textlayoutcache.h"
 
 #include "symbolfonts.h"
 #include "smufl.h"
@@ -95,17 +100,46 @@ double SymbolFont::textEnclosureThickness()
 
 void SymbolFont::load()
 {
+    TRACEFUNC;
+
+    auto begin = std::chrono::steady_clock::now();
+
     if (-1 == fontProvider()->addSymbolFont(m_family, m_fontPath)) {
         LOGE() << "fatal error: cannot load internal font: " << m_fontPath;
         return;
     }
 
+    TextLayoutCache::instance()->invalidate();
+
     m_font.setWeight(mu::draw::Font::Normal);
     m_font.setItalic(false);
     m_font.setFamily(m_family);
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    //! NOTE Computing the metrics of all glyphs and parsing the metadata is slow,
+    //! so the result is stored in a binary cache and read from it next time
+    path_t cachePath = metricsCachePath();
+    bool fromCache = !cachePath.empty() && readMetricsCache(cachePath);
+    if (!fromCache) {
+        if (!loadMetrics()) {
+            return;
+        }
+
+        if (!cachePath.empty()) {
+            writeMetricsCache(cachePath);
+        }
+    }
+
+    m_loaded.store(true, std::memory_order_release);
+
+    auto end = std::chrono::steady_clock::now();
+    LOGI() << "loaded symbol font: " << m_name << ", from cache: " << fromCache
+           << ", time: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms";
+}
+
+bool SymbolFont::loadMetrics()
+{
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -115,17 +149,17 @@ void SymbolFont::load()
         computeMetrics(sym, code);
     }
 
-    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
+    File metadataFile(metadataPath());
     if (!metadataFile.open(IODevice::ReadOnly)) {
         LOGE() << "Failed to open glyph metadata file: " << metadataFile.filePath();
-        return;
+        return false;
     }
 
     std::string error;
     JsonObject metadataJson = JsonDocument::fromJson(metadataFile.readAll(), &error).rootObject();
     if (!error.empty()) {
         LOGE() << "Json parse error in " << metadataFile.filePath() << ", error: " << error;
-        return;
+        return false;
     }
 
     loadGlyphsWithAnchors(metadataJson.value("glyphsWithAnchors").toObject());
@@ -133,7 +167,12 @@ void SymbolFont::load()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
-    m_loaded = true;
+    return true;
+}
+
+path_t SymbolFont::metadataPath() const
+{
+    return io::FileInfo(m_fontPath).path() + u"/metadata.json";
 }
 
 void SymbolFont::loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors)
@@ -512,6 +551,277 @@ void SymbolFont::computeMetrics(SymbolFont::Sym& sym, const Smufl::Code& code)
     }
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+static constexpr char METRICS_CACHE_SIGNATURE[4] = { 'M', 'S', 'F', 'M' };
+//! NOTE Increase when computeMetrics or the cache format changes
+static constexpr uint32_t METRICS_CACHE_VERSION = 3;
+
+namespace {
+class CacheWriter
+{
+public:
+    template<typename T>
+    void write(const T& v)
+    {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(&v);
+        m_data.insert(m_data.end(), p, p + sizeof(T));
+    }
+
+    void writeBytes(const ByteArray& ba)
+    {
+        write(static_cast<uint32_t>(ba.size()));
+        m_data.insert(m_data.end(), ba.constData(), ba.constData() + ba.size());
+    }
+
+    void writeRect(const RectF& r)
+    {
+        write(r.x());
+        write(r.y());
+        write(r.width());
+        write(r.height());
+    }
+
+    ByteArray data() const { return ByteArray(m_data.data(), m_data.size()); }
+
+private:
+    std::vector<uint8_t> m_data;
+};
+
+class CacheReader
+{
+public:
+    CacheReader(const ByteArray& data)
+        : m_pos(data.constData()), m_end(data.constData() + data.size()) {}
+
+    template<typename T>
+    T read()
+    {
+        T v {};
+        if (m_end - m_pos < static_cast<std::ptrdiff_t>(sizeof(T))) {
+            m_ok = false;
+            return v;
+        }
+
+        std::memcpy(&v, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return v;
+    }
+
+    ByteArray readBytes()
+    {
+        uint32_t size = read<uint32_t>();
+        if (!m_ok || m_end - m_pos < static_cast<std::ptrdiff_t>(size)) {
+            m_ok = false;
+            return ByteArray();
+        }
+
+        ByteArray ba(m_pos, size);
+        m_pos += size;
+        return ba;
+    }
+
+    RectF readRect()
+    {
+        double x = read<double>();
+        double y = read<double>();
+        double w = read<double>();
+        double h = read<double>();
+        return RectF(x, y, w, h);
+    }
+
+    bool ok() const { return m_ok; }
+    bool atEnd() const { return m_pos == m_end; }
+
+private:
+    const uint8_t* m_pos = nullptr;
+    const uint8_t* m_end = nullptr;
+    bool m_ok = true;
+};
+}
+
+path_t SymbolFont::metricsCachePath() const
+{
+    if (!globalConfiguration()) {
+        return path_t();
+    }
+
+    return globalConfiguration()->userAppDataPath() + "/fontmetrics/" + m_name + ".bin";
+}
+
+//! NOTE The cache is valid for the same build of the app, the same font files and the same list of symbols.
+//! The files are compared by size and modification time, so the stamp is cheap to get on every load
+ByteArray SymbolFont::metricsCacheStamp() const
+{
+    RetVal<uint64_t> fontSize = fileSystem()->fileSize(m_fontPath);
+    RetVal<uint64_t> metadataSize = fileSystem()->fileSize(metadataPath());
+    if (!fontSize.ret || !metadataSize.ret) {
+        return ByteArray();
+    }
+
+    String stamp = String(u"%1 %2 %3 %4 %5 %6 %7")
+                   .arg(String::fromStdString(framework::Version::fullVersion()))
+                   .arg(String::fromStdString(framework::Version::revision()))
+                   .arg(static_cast<int64_t>(fontSize.val))
+                   .arg(fileSystem()->lastModified(m_fontPath).toString())
+                   .arg(static_cast<int64_t>(metadataSize.val))
+                   .arg(fileSystem()->lastModified(metadataPath()).toString())
+                   .arg(static_cast<int64_t>(m_symbols.size()));
+
+    return stamp.toUtf8();
+}
+
+bool SymbolFont::readMetricsCache(const path_t& path)
+{
+    RetVal<ByteArray> data = fileSystem()->readFile(path);
+    if (!data.ret) {
+        return false;
+    }
+
+    CacheReader r(data.val);
+    for (char c : METRICS_CACHE_SIGNATURE) {
+        if (r.read<char>() != c) {
+            return false;
+        }
+    }
+
+    if (r.read<uint32_t>() != METRICS_CACHE_VERSION) {
+        return false;
+    }
+
+    ByteArray stamp = r.readBytes();
+    if (stamp.empty() || stamp != metricsCacheStamp()) {
+        return false;
+    }
+
+    std::vector<Sym> symbols(m_symbols.size());
+    uint32_t symCount = r.read<uint32_t>();
+    for (uint32_t i = 0; i < symCount && r.ok(); ++i) {
+        uint32_t id = r.read<uint32_t>();
+        if (id >= symbols.size()) {
+            return false;
+        }
+
+        Sym& sym = symbols[id];
+        sym.code = r.read<char32_t>();
+        sym.bbox = r.readRect();
+        sym.advance = r.read<double>();
+
+        uint8_t anchorCount = r.read<uint8_t>();
+        for (uint8_t a = 0; a < anchorCount; ++a) {
+            SmuflAnchorId anchorId = static_cast<SmuflAnchorId>(r.read<uint8_t>());
+            double x = r.read<double>();
+            double y = r.read<double>();
+            sym.smuflAnchors[anchorId] = PointF(x, y);
+        }
+
+        uint8_t subCount = r.read<uint8_t>();
+        for (uint8_t s = 0; s < subCount; ++s) {
+            sym.subSymbolIds.push_back(static_cast<SymId>(r.read<uint32_t>()));
+        }
+    }
+
+    std::unordered_map<Sid, PropertyValue> engravingDefaults;
+    uint32_t defaultsCount = r.read<uint32_t>();
+    for (uint32_t i = 0; i < defaultsCount && r.ok(); ++i) {
+        Sid sid = static_cast<Sid>(r.read<uint32_t>());
+        bool isBool = r.read<uint8_t>() != 0;
+        double value = r.read<double>();
+        engravingDefaults.insert({ sid, isBool ? PropertyValue(value != 0.0) : PropertyValue(value) });
+    }
+    engravingDefaults.insert({ Sid::MusicalTextFont, String(u"%1 Text").arg(m_family) });
+
+    double textEnclosureThickness = r.read<double>();
+
+    if (!r.ok() || !r.atEnd()) {
+        LOGW() << "corrupted font metrics cache: " << path;
+        return false;
+    }
+
+    m_symbols = std::move(symbols);
+    m_engravingDefaults = std::move(engravingDefaults);
+    m_textEnclosureThickness = textEnclosureThickness;
+
+    return true;
+}
+
+void SymbolFont::writeMetricsCache(const path_t& path) const
+{
+    CacheWriter w;
+    for (char c : METRICS_CACHE_SIGNATURE) {
+        w.write(c);
+    }
+
+    ByteArray stamp = metricsCacheStamp();
+    if (stamp.empty()) {
+        return;
+    }
+
+    w.write(METRICS_CACHE_VERSION);
+    w.writeBytes(stamp);
+
+    uint32_t symCount = 0;
+    for (const Sym& sym : m_symbols) {
+        if (sym.code != 0 || !sym.smuflAnchors.empty() || sym.isCompound()) {
+            ++symCount;
+        }
+    }
+
+    w.write(symCount);
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        const Sym& sym = m_symbols.at(id);
+        if (sym.code == 0 && sym.smuflAnchors.empty() && !sym.isCompound()) {
+            continue;
+        }
+
+        w.write(static_cast<uint32_t>(id));
+        w.write(sym.code);
+        w.writeRect(sym.bbox);
+        w.write(sym.advance);
+
+        w.write(static_cast<uint8_t>(sym.smuflAnchors.size()));
+        for (const auto& a : sym.smuflAnchors) {
+            w.write(static_cast<uint8_t>(a.first));
+            w.write(a.second.x());
+            w.write(a.second.y());
+        }
+
+        w.write(static_cast<uint8_t>(sym.subSymbolIds.size()));
+        for (SymId subId : sym.subSymbolIds) {
+            w.write(static_cast<uint32_t>(subId));
+        }
+    }
+
+    uint32_t defaultsCount = 0;
+    for (const auto& d : m_engravingDefaults) {
+        if (d.second.type() == P_TYPE::BOOL || d.second.type() == P_TYPE::REAL) {
+            ++defaultsCount;
+        }
+    }
+
+    w.write(defaultsCount);
+    for (const auto& d : m_engravingDefaults) {
+        bool isBool = d.second.type() == P_TYPE::BOOL;
+        if (!isBool && d.second.type() != P_TYPE::REAL) {
+            continue;
+        }
+
+        w.write(static_cast<uint32_t>(d.first));
+        w.write(static_cast<uint8_t>(isBool));
+        w.write(isBool ? (d.second.toBool() ? 1.0 : 0.0) : d.second.toReal());
+    }
+
+    w.write(m_textEnclosureThickness);
+
+    fileSystem()->makePath(io::FileInfo(path).path());
+    Ret ret = fileSystem()->writeFile(path, w.data());
+    if (!ret) {
+        LOGW() << "failed write font metrics cache: " << path << ", err: " << ret.toString();
+    }
+}
+
 // =============================================
 // Symbol properties
 // =============================================
@@ -680,18 +990,37 @@ void SymbolFont::draw(SymId id, mu::draw::Painter* painter, double mag, const Po
 
 void SymbolFont::draw(const SymIdList& ids, Painter* painter, double mag, const PointF& startPos) const
 {
-    PointF pos(startPos);
-    for (SymId id : ids) {
-        draw(id, painter, mag, pos);
-        pos.setX(pos.x() + advance(id, mag));
-    }
+    draw(ids, painter, SizeF(mag, mag), startPos);
 }
 
 void SymbolFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const PointF& startPos) const
 {
+    //! NOTE The painter state is set once for the plain symbols of the list,
+    //! so they are passed to the provider as one run (e.g. the wiggles of trills and vibratos)
+    bool stateSet = false;
     PointF pos(startPos);
     for (SymId id : ids) {
-        draw(id, painter, mag, pos);
+        const Sym& sym = this->sym(id);
+        if (sym.isValid() && !sym.isCompound()) {
+            if (!stateSet) {
+                painter->save();
+                m_font.setPointSizeF(20.0 * MScore::pixelRatio);
+                painter->scale(mag.width(), mag.height());
+                painter->setFont(m_font);
+                stateSet = true;
+            }
+            painter->drawSymbol(PointF(pos.x() / mag.width(), pos.y() / mag.height()), symCode(id));
+        } else {
+            if (stateSet) {
+                painter->restore();
+                stateSet = false;
+            }
+            draw(id, painter, mag, pos);
+        }
         pos.setX(pos.x() + advance(id, mag.width()));
     }
+
+    if (stateSet) {
+        painter->restore();
+    }
 }
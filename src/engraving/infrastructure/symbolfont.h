@@ -22,6 +22,7 @@
 #ifndef MU_ENGRAVING_SYMBOLFONT_H
 #define MU_ENGRAVING_SYMBOLFONT_H
 
+#include <atomic>
 #include <unordered_map>
 
 #include "style/style.h"
@@ -30,6 +31,8 @@
 
 #include "modularity/ioc.h"
 #include "draw/ifontprovider.h"
+#include "iglobalconfiguration.h"
+#include "io/ifilesystem.h"
 #include "io/path.h"
 
 #include "smufl.h"
@@ -46,6 +49,8 @@ namespace mu::engraving {
 class SymbolFont
 {
     INJECT_STATIC(score, mu::draw::IFontProvider, fontProvider)
+    INJECT_STATIC(score, framework::IGlobalConfiguration, globalConfiguration)
+    INJECT_STATIC(score, io::IFileSystem, fileSystem)
 
 public:
     SymbolFont(const String& name, const String& family, const io::path_t& filePath);
@@ -107,6 +112,14 @@ private:
     };
 
     void load();
+    bool loadMetrics();
+    io::path_t metadataPath() const;
+
+    io::path_t metricsCachePath() const;
+    ByteArray metricsCacheStamp() const;
+    bool readMetricsCache(const io::path_t& path);
+    void writeMetricsCache(const io::path_t& path) const;
+
     void loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors);
     void loadComposedGlyphs();
     void loadStylisticAlternates(const JsonObject& glyphsWithAlternatesObject);
@@ -116,7 +129,7 @@ private:
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
-    bool m_loaded = false;
+    std::atomic<bool> m_loaded = false;
     std::vector<Sym> m_symbols;
     mutable draw::Font m_font;
 
@@ -22,7 +22,12 @@
 
 #include "symbolfonts.h"
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
 #include "containers.h"
+#include "runtime.h"
 
 #include "log.h"
 
@@ -31,6 +36,36 @@ using namespace mu::engraving;
 std::vector<SymbolFont> SymbolFonts::s_symbolFonts {};
 SymbolFonts::Fallback SymbolFonts::s_fallback = {};
 
+//! NOTE Fonts are loaded lazily, on the first use, which may happen in several threads at the same time
+static std::mutex s_loadMutex;
+
+namespace {
+struct BackgroundLoad {
+    std::thread thread;
+
+    ~BackgroundLoad()
+    {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+};
+}
+
+static BackgroundLoad s_backgroundLoad;
+
+void SymbolFonts::loadIfNeeded(SymbolFont* font)
+{
+    if (font->m_loaded.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(s_loadMutex);
+    if (!font->m_loaded.load(std::memory_order_relaxed)) {
+        font->load();
+    }
+}
+
 void SymbolFonts::addFont(const String& name, const String& family, const io::path_t& filePath)
 {
     s_symbolFonts.push_back(SymbolFont(name, family, filePath));
@@ -65,9 +100,7 @@ SymbolFont* SymbolFonts::fontByName(const String& name)
         return font;
     }
 
-    if (!font->m_loaded) {
-        font->load();
-    }
+    loadIfNeeded(font);
 
     return font;
 }
@@ -96,13 +129,38 @@ SymbolFont* SymbolFonts::fallbackFont()
 {
     SymbolFont* font = &s_symbolFonts[s_fallback.index];
 
-    if (!font->m_loaded) {
-        font->load();
-    }
+    loadIfNeeded(font);
 
     return font;
 }
 
+void SymbolFonts::loadInBackground(const std::vector<String>& names)
+{
+    waitBackgroundLoad();
+
+    std::vector<SymbolFont*> fonts;
+    for (SymbolFont& f : s_symbolFonts) {
+        if (std::find(names.cbegin(), names.cend(), f.name()) != names.cend()) {
+            fonts.push_back(&f);
+        }
+    }
+
+    //! NOTE s_symbolFonts must not change while the fonts are loaded
+    s_backgroundLoad.thread = std::thread([fonts]() {
+        mu::runtime::setThreadName("symbol_fonts_load");
+        for (SymbolFont* f : fonts) {
+            loadIfNeeded(f);
+        }
+    });
+}
+
+void SymbolFonts::waitBackgroundLoad()
+{
+    if (s_backgroundLoad.thread.joinable()) {
+        s_backgroundLoad.thread.join();
+    }
+}
+
 const char* SymbolFonts::fallbackTextFont()
 {
     return "Bravura Text";
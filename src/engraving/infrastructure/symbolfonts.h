@@ -42,8 +42,15 @@ public:
     static SymbolFont* fallbackFont();
     static const char* fallbackTextFont();
 
+    //! NOTE Starts loading the given fonts in a background thread,
+    //! the first use of a font that is still being loaded waits for it
+    static void loadInBackground(const std::vector<String>& names);
+    static void waitBackgroundLoad();
+
 private:
 
+    static void loadIfNeeded(SymbolFont* font);
+
     struct Fallback {
         String name;
         size_t index = 0;
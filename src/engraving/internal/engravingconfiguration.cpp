@@ -36,6 +36,8 @@ static const Settings::Key PART_STYLE_FILE_PATH("engraving", "engraving/style/pa
 
 static const Settings::Key INVERT_SCORE_COLOR("engraving", "engraving/scoreColorInversion");
 
+static const Settings::Key UNDO_MEMORY_BUDGET_MB("engraving", "engraving/undo/memoryBudgetMB");
+
 struct VoiceColorKey {
     Settings::Key key;
     Color color;
@@ -53,9 +55,14 @@ void EngravingConfiguration::init()
     };
 
     settings()->setDefaultValue(INVERT_SCORE_COLOR, Val(false));
+    settings()->setDefaultValue(UNDO_MEMORY_BUDGET_MB, Val(256));
+    settings()->setCanBeManuallyEdited(UNDO_MEMORY_BUDGET_MB, true);
     settings()->valueChanged(INVERT_SCORE_COLOR).onReceive(nullptr, [this](const Val&) {
         m_scoreInversionChanged.notify();
     });
+    settings()->valueChanged(UNDO_MEMORY_BUDGET_MB).onReceive(this, [this](const Val&) {
+        m_undoMemoryBudgetChanged.send(undoMemoryBudget());
+    });
 
     for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
         Settings::Key key("engraving", "engraving/colors/voice" + std::to_string(voice + 1));
@@ -208,3 +215,14 @@ bool EngravingConfiguration::isAccessibleEnabled() const
 {
     return accessibilityConfiguration() ? accessibilityConfiguration()->enabled() : false;
 }
+
+size_t EngravingConfiguration::undoMemoryBudget() const
+{
+    int megabytes = settings()->value(UNDO_MEMORY_BUDGET_MB).toInt();
+    return megabytes > 0 ? static_cast<size_t>(megabytes) * 1024 * 1024 : 0;
+}
+
+mu::async::Channel<size_t> EngravingConfiguration::undoMemoryBudgetChanged() const
+{
+    return m_undoMemoryBudgetChanged;
+}
@@ -82,9 +82,13 @@ public:
 
     bool isAccessibleEnabled() const override;
 
+    size_t undoMemoryBudget() const override;
+    async::Channel<size_t> undoMemoryBudgetChanged() const override;
+
 private:
     async::Channel<voice_idx_t, draw::Color> m_voiceColorChanged;
     async::Notification m_scoreInversionChanged;
+    async::Channel<size_t> m_undoMemoryBudgetChanged;
 
     ValNt<DebuggingOptions> m_debuggingOptions;
 };
@@ -654,6 +654,7 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
         return;
     }
 
+    measure->resetSegmentDistances();
     measure->connectTremolo();
 
     //
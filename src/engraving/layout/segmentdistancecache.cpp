@@ -0,0 +1,171 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "segmentdistancecache.h"
+
+#include <atomic>
+#include <functional>
+
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static void hashCombine(size_t& seed, size_t v)
+{
+    seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static void hashCombine(size_t& seed, double v)
+{
+    hashCombine(seed, std::hash<double> {}(v));
+}
+
+static void hashCombine(size_t& seed, const void* p)
+{
+    hashCombine(seed, std::hash<const void*> {}(p));
+}
+
+static std::atomic<uint64_t> s_hits = 0;
+static std::atomic<uint64_t> s_misses = 0;
+
+double SegmentDistanceCache::Stats::hitRate() const
+{
+    uint64_t total = hits + misses;
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+SegmentDistanceCache::Stats SegmentDistanceCache::stats()
+{
+    Stats s;
+    s.hits = s_hits;
+    s.misses = s_misses;
+    return s;
+}
+
+size_t SegmentDistanceCache::KeyHash::operator()(const Key& k) const
+{
+    size_t h = 0;
+    hashCombine(h, static_cast<const void*>(k.s));
+    hashCombine(h, static_cast<const void*>(k.ns));
+    hashCombine(h, static_cast<size_t>(k.colliding));
+    return h;
+}
+
+void SegmentDistanceCache::ShapesKey::clear()
+{
+    values.clear();
+    items.clear();
+    types.clear();
+}
+
+void SegmentDistanceCache::collectKey(const Measure* measure, ShapesKey& key)
+{
+    key.clear();
+    key.values.push_back(measure->spatium());
+    key.types.push_back(static_cast<size_t>(measure->isMMRest()));
+
+    for (const Segment& s : measure->segments()) {
+        key.items.push_back(&s);
+        key.types.push_back(static_cast<size_t>(s.segmentType()));
+        key.values.push_back(s.extraLeadingSpace().val());
+
+        for (const Shape& shape : s.shapes()) {
+            key.types.push_back(shape.size());
+            for (const ShapeElement& e : shape) {
+                key.values.push_back(e.x());
+                key.values.push_back(e.y());
+                key.values.push_back(e.width());
+                key.values.push_back(e.height());
+                key.items.push_back(e.toItem);
+            }
+        }
+    }
+}
+
+size_t SegmentDistanceCache::keyHash(const ShapesKey& key)
+{
+    size_t h = 0;
+    for (double v : key.values) {
+        hashCombine(h, v);
+    }
+    for (const void* p : key.items) {
+        hashCombine(h, p);
+    }
+    for (size_t t : key.types) {
+        hashCombine(h, t);
+    }
+    return h;
+}
+
+void SegmentDistanceCache::validate(const Measure* measure)
+{
+    //! NOTE Reused between the calls, so collecting the key doesn't allocate every time
+    static thread_local ShapesKey key;
+
+    collectKey(measure, key);
+    size_t hash = keyHash(key);
+    if (hash == m_keyHash && key == m_key) {
+        return;
+    }
+
+    m_distances.clear();
+    m_keyHash = hash;
+    std::swap(m_key, key);
+}
+
+void SegmentDistanceCache::reset()
+{
+    m_distances.clear();
+    m_keyHash = 0;
+    m_key = ShapesKey();
+}
+
+double SegmentDistanceCache::minHorizontalDistance(const Segment* s, Segment* ns)
+{
+    Key key { s, ns, false };
+    auto it = m_distances.find(key);
+    if (it != m_distances.end()) {
+        ++s_hits;
+        return it->second;
+    }
+
+    ++s_misses;
+    double d = s->minHorizontalDistance(ns, false);
+    m_distances.emplace(key, d);
+    return d;
+}
+
+double SegmentDistanceCache::minHorizontalCollidingDistance(const Segment* s, Segment* ns)
+{
+    Key key { s, ns, true };
+    auto it = m_distances.find(key);
+    if (it != m_distances.end()) {
+        ++s_hits;
+        return it->second;
+    }
+
+    ++s_misses;
+    double d = s->minHorizontalCollidingDistance(ns);
+    m_distances.emplace(key, d);
+    return d;
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SEGMENTDISTANCECACHE_H
+#define MU_ENGRAVING_SEGMENTDISTANCECACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace mu::engraving {
+class Measure;
+class Segment;
+
+//! NOTE The minimal horizontal distances between the segments of a measure.
+//! They depend only on the segment shapes, but Measure::computeWidth() needs them again
+//! for every shortest note and stretch tried while the system is collected and justified.
+//! The distances are kept along with the key of the shapes they were computed from
+//! (geometry and items of the shape elements, segment types, spatium), which is checked on every use:
+//! the hash of the key first, the whole key when the hashes match.
+//! The properties of the items affecting the padding (kerning, mag) don't change during the layout,
+//! the cache is reset when the measure is laid out again in LayoutMeasure::getNextMeasure().
+class SegmentDistanceCache
+{
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        double hitRate() const;
+    };
+
+    //! NOTE Counted for all the measures of all the scores
+    static Stats stats();
+
+    void validate(const Measure* measure);
+    void reset();
+
+    //! NOTE Segment::minHorizontalDistance() without the system header gap
+    double minHorizontalDistance(const Segment* s, Segment* ns);
+    double minHorizontalCollidingDistance(const Segment* s, Segment* ns);
+
+private:
+    struct Key {
+        const Segment* s = nullptr;
+        const Segment* ns = nullptr;
+        bool colliding = false;
+
+        bool operator==(const Key& k) const { return s == k.s && ns == k.ns && colliding == k.colliding; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const;
+    };
+
+    struct ShapesKey {
+        std::vector<double> values;             // spatium, leading spaces, geometry of the shape elements
+        std::vector<const void*> items;         // segments and items of the shape elements
+        std::vector<size_t> types;              // mmrest flag, segment types, shape sizes
+
+        bool operator==(const ShapesKey& k) const { return values == k.values && items == k.items && types == k.types; }
+        void clear();
+    };
+
+    static void collectKey(const Measure* measure, ShapesKey& key);
+    static size_t keyHash(const ShapesKey& key);
+
+    size_t m_keyHash = 0;
+    ShapesKey m_key;
+    std::unordered_map<Key, double, KeyHash> m_distances;
+};
+}
+
+#endif // MU_ENGRAVING_SEGMENTDISTANCECACHE_H
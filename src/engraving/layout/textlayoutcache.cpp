@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "textlayoutcache.h"
+
+#include <functional>
+#include <mutex>
+
+#include "libmscore/score.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//! NOTE Enough for the distinct lines of several big scores, the cache is dropped when it's exceeded
+static constexpr size_t MAX_GEOMETRIES = 50000;
+
+static void hashCombine(size_t& seed, size_t v)
+{
+    seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static void hashCombine(size_t& seed, double v)
+{
+    hashCombine(seed, std::hash<double> {}(v));
+}
+
+double TextLayoutCache::Stats::hitRate() const
+{
+    uint64_t total = hits + misses;
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+TextLayoutCache* TextLayoutCache::instance()
+{
+    static TextLayoutCache cache;
+    return &cache;
+}
+
+TextLayoutCache::Key::Key(const TextBase* t, const std::list<TextFragment>& fragments)
+{
+    m_fragments.reserve(fragments.size());
+
+    bool hasScoreText = false;
+    for (const TextFragment& f : fragments) {
+        m_fragments.push_back({ f.text, f.format });
+
+        hashCombine(m_hash, f.text.hash());
+        hashCombine(m_hash, f.format.fontFamily().hash());
+        hashCombine(m_hash, f.format.fontSize());
+        hashCombine(m_hash, static_cast<size_t>(f.format.style()));
+        hashCombine(m_hash, static_cast<size_t>(f.format.valign()));
+
+        hasScoreText = hasScoreText || f.format.fontFamily() == u"ScoreText";
+    }
+
+    m_spatium = t->sizeIsSpatiumDependent() ? t->spatium() : 0.0;
+    m_mag = t->mag();
+    hashCombine(m_hash, m_spatium);
+    hashCombine(m_hash, m_mag);
+
+    //! NOTE See TextFragment::font
+    if (hasScoreText) {
+        m_musicalTextFont = t->score()->styleSt(Sid::MusicalTextFont);
+        m_musicalSymbolFont = t->score()->styleSt(Sid::MusicalSymbolFont);
+        m_type = static_cast<int>(t->type());
+        m_textStyleType = static_cast<int>(t->textStyleType());
+        hashCombine(m_hash, m_musicalTextFont.hash());
+        hashCombine(m_hash, m_musicalSymbolFont.hash());
+        hashCombine(m_hash, static_cast<size_t>(m_type));
+        hashCombine(m_hash, static_cast<size_t>(m_textStyleType));
+    }
+}
+
+bool TextLayoutCache::Key::operator==(const Key& k) const
+{
+    if (m_hash != k.m_hash
+        || m_fragments.size() != k.m_fragments.size()
+        || m_spatium != k.m_spatium
+        || m_mag != k.m_mag
+        || m_type != k.m_type
+        || m_textStyleType != k.m_textStyleType
+        || m_musicalTextFont != k.m_musicalTextFont
+        || m_musicalSymbolFont != k.m_musicalSymbolFont) {
+        return false;
+    }
+
+    for (size_t i = 0; i < m_fragments.size(); ++i) {
+        const Fragment& f1 = m_fragments.at(i);
+        const Fragment& f2 = k.m_fragments.at(i);
+        if (f1.text != f2.text || !(f1.format == f2.format)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TextLayoutCache::find(const Key& key, Geometry& geometry) const
+{
+    std::shared_lock lock(m_mutex);
+
+    auto it = m_geometries.find(key);
+    if (it == m_geometries.end()) {
+        ++m_misses;
+        return false;
+    }
+
+    ++m_hits;
+    geometry = it->second;
+    return true;
+}
+
+void TextLayoutCache::insert(const Key& key, const Geometry& geometry)
+{
+    std::unique_lock lock(m_mutex);
+
+    if (m_geometries.size() >= MAX_GEOMETRIES) {
+        m_geometries.clear();
+    }
+
+    m_geometries.emplace(key, geometry);
+}
+
+void TextLayoutCache::invalidate()
+{
+    std::unique_lock lock(m_mutex);
+
+    m_geometries.clear();
+    ++m_invalidations;
+}
+
+TextLayoutCache::Stats TextLayoutCache::stats() const
+{
+    Stats s;
+    s.hits = m_hits;
+    s.misses = m_misses;
+    s.invalidations = m_invalidations;
+    return s;
+}
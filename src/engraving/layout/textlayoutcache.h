@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_TEXTLAYOUTCACHE_H
+#define MU_ENGRAVING_TEXTLAYOUTCACHE_H
+
+#include <atomic>
+#include <list>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "types/string.h"
+#include "draw/types/geometry.h"
+
+#include "libmscore/textbase.h"
+
+namespace mu::engraving {
+//! NOTE The geometry of the laid out text lines (TextBlock), before they are aligned.
+//! It depends only on the fragment texts and formats (font family, size, style, vertical alignment),
+//! on the spatium and the mag of the text, so the texts with the same content share it,
+//! for example the repeated lyrics syllables, fingerings and chord symbols.
+//! The fragments in the "ScoreText" family are resolved to the musical fonts of the score style,
+//! the style fonts and the kind of the text are part of the key for them.
+//! The cache is invalidated when fonts are added or a score style changes.
+//! Thread safe, the scores may be laid out in parallel.
+class TextLayoutCache
+{
+public:
+    static TextLayoutCache* instance();
+
+    class Key
+    {
+    public:
+        Key(const TextBase* t, const std::list<TextFragment>& fragments);
+
+        bool operator==(const Key& k) const;
+        size_t hash() const { return m_hash; }
+
+    private:
+        struct Fragment {
+            String text;
+            CharFormat format;
+        };
+
+        std::vector<Fragment> m_fragments;
+        double m_spatium = 0.0;
+        double m_mag = 1.0;
+
+        String m_musicalTextFont;
+        String m_musicalSymbolFont;
+        int m_type = 0;
+        int m_textStyleType = 0;
+
+        size_t m_hash = 0;
+    };
+
+    struct Geometry {
+        std::vector<PointF> positions;
+        RectF bbox;
+        double lineSpacing = 0.0;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t invalidations = 0;
+
+        double hitRate() const;
+    };
+
+    bool find(const Key& key, Geometry& geometry) const;
+    void insert(const Key& key, const Geometry& geometry);
+
+    void invalidate();
+
+    Stats stats() const;
+
+private:
+    TextLayoutCache() = default;
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const { return k.hash(); }
+    };
+
+    std::unordered_map<Key, Geometry, KeyHash> m_geometries;
+    mutable std::shared_mutex m_mutex;
+
+    mutable std::atomic<uint64_t> m_hits = 0;
+    mutable std::atomic<uint64_t> m_misses = 0;
+    std::atomic<uint64_t> m_invalidations = 0;
+};
+}
+
+#endif // MU_ENGRAVING_TEXTLAYOUTCACHE_H
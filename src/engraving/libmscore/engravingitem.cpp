@@ -2707,18 +2707,28 @@ void EngravingItem::setSelected(bool f)
         initAccessibleIfNeed();
 
         if (m_accessible) {
+            //! NOTE The roots are made on demand, the one of the other tree may not exist yet
+            auto rootOf = [](const RootItem* rootItem) -> AccessibleRoot* {
+                AccessibleItemPtr accessible = rootItem->accessible();
+                return accessible ? accessible->accessibleRoot() : nullptr;
+            };
+
             AccessibleRoot* currAccRoot = m_accessible->accessibleRoot();
-            AccessibleRoot* accRoot = score()->rootItem()->accessible()->accessibleRoot();
-            AccessibleRoot* dummyAccRoot = score()->dummy()->rootItem()->accessible()->accessibleRoot();
+            AccessibleRoot* accRoot = rootOf(score()->rootItem());
+            AccessibleRoot* dummyAccRoot = rootOf(score()->dummy()->rootItem());
 
             if (accRoot && currAccRoot == accRoot && accRoot->registered()) {
                 accRoot->setFocusedElement(m_accessible);
-                dummyAccRoot->setFocusedElement(nullptr);
+                if (dummyAccRoot) {
+                    dummyAccRoot->setFocusedElement(nullptr);
+                }
             }
 
             if (dummyAccRoot && currAccRoot == dummyAccRoot && dummyAccRoot->registered()) {
                 dummyAccRoot->setFocusedElement(m_accessible);
-                accRoot->setFocusedElement(nullptr);
+                if (accRoot) {
+                    accRoot->setFocusedElement(nullptr);
+                }
             }
         }
     }
@@ -191,6 +191,9 @@ public:
     bool accessibleEnabled() const;
     void setAccessibleEnabled(bool enabled);
 
+    //! NOTE Makes the accessible items of the element and its parents, if accessibility is enabled
+    void initAccessibleIfNeed();
+
     EngravingItem& operator=(const EngravingItem&) = delete;
     //@ create a copy of the element
     virtual EngravingItem* clone() const = 0;
@@ -562,9 +565,6 @@ public:
     void setColorsInverionEnabled(bool enabled);
 
     std::pair<int, float> barbeat() const;
-
-private:
-    void initAccessibleIfNeed();
 };
 
 using ElementPtr = std::shared_ptr<EngravingItem>;
@@ -152,6 +152,8 @@ ImageStore::~ImageStore()
 
 ImageStoreItem* ImageStore::getImage(const path_t& path) const
 {
+    std::lock_guard<std::mutex> lock(_mutex);
+
     String s = FileInfo(path).completeBaseName();
     if (s.size() != 32) {
         //
@@ -184,6 +186,8 @@ ImageStoreItem* ImageStore::getImage(const path_t& path) const
 ImageStoreItem* ImageStore::add(const path_t& path, const ByteArray& ba)
 {
     ByteArray hash = cryptographicHash()->hash(ba, ICryptographicHash::Algorithm::Md4);
+
+    std::lock_guard<std::mutex> lock(_mutex);
     for (ImageStoreItem* item : _items) {
         if (item->hash() == hash) {
             return item;
@@ -201,6 +205,7 @@ ImageStoreItem* ImageStore::add(const path_t& path, const ByteArray& ba)
 
 void ImageStore::clearUnused()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _items.erase(
         std::remove_if(_items.begin(), _items.end(), [](ImageStoreItem* i) {
         const bool remove = !i->isUsed();
@@ -24,6 +24,7 @@
 #define __IMAGE_CACHE_H__
 
 #include <list>
+#include <mutex>
 #include "types/string.h"
 #include "types/bytearray.h"
 #include "io/path.h"
@@ -77,6 +78,7 @@ class ImageStore
 
     typedef std::vector<ImageStoreItem*> ItemList;
     ItemList _items;
+    mutable std::mutex _mutex;
 
 public:
     ImageStore() = default;
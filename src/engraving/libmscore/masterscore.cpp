@@ -57,6 +57,10 @@ MasterScore::MasterScore(std::weak_ptr<engraving::EngravingProject> project)
 {
     m_project = project;
     _undoStack   = new UndoStack();
+    if (engravingConfiguration()) {
+        _undoStack->setMemoryBudget(engravingConfiguration()->undoMemoryBudget());
+    }
+
     _tempomap    = new TempoMap;
     _sigmap      = new TimeSigMap();
     _repeatList  = new RepeatList(this);
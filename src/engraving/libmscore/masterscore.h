@@ -23,6 +23,7 @@
 #define MU_ENGRAVING_MASTERSCORE_H
 
 #include "infrastructure/ifileinfoprovider.h"
+#include "iengravingconfiguration.h"
 
 #include "score.h"
 #include "instrument.h"
@@ -78,6 +79,8 @@ class MasterScore : public Score
 {
     OBJECT_ALLOCATOR(engraving, MasterScore)
 
+    INJECT(engraving, IEngravingConfiguration, engravingConfiguration)
+
     UndoStack* _undoStack = nullptr;
     TimeSigMap* _sigmap;
     TempoMap* _tempomap;
@@ -4199,6 +4199,8 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
     usrStretch = std::min(usrStretch, double(10)); // Higher values may cause the spacing to break (10 is already ridiculously high and no user should even use that)
     double durStretch = 1;
 
+    m_segmentDistances.validate(this);
+
     while (s) {
         s->setPosX(x);
         // skip disabled / invisible segments
@@ -4237,7 +4239,7 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
                 w = s->minHorizontalDistance(ns, true);
                 isSystemHeader = false;
             } else {
-                w = s->minHorizontalDistance(ns, false);
+                w = m_segmentDistances.minHorizontalDistance(s, ns);
                 // New spacing algorithm: we apply an additional spacing which depends on the duration of
                 // the note with respect to the shortest note *of the system*.
                 if (s->isChordRestType()) {
@@ -4263,7 +4265,8 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
             // Clefs (or breaths) are justified right-to-left. It is the clef (or breath) that needs to move left
             //(if there's space), not the following segment that needs to move right.
             if ((ns->isClefType() || ns->isBreathType()) && ns->next()) {
-                w -= std::max(ns->minHorizontalCollidingDistance(ns->next()), double(score()->styleMM(Sid::clefKeyRightMargin)));
+                w -= std::max(m_segmentDistances.minHorizontalCollidingDistance(ns, ns->next()),
+                              double(score()->styleMM(Sid::clefKeyRightMargin)));
             }
 
             // Adjust the spacing for cross-staff beams situations
@@ -4300,7 +4303,7 @@ void Measure::computeWidth(Segment* s, double x, bool isSystemHeader, Fraction m
                     break;
                 }
 
-                ww = ps->minHorizontalCollidingDistance(ns) - (s->x() - ps->x());
+                ww = m_segmentDistances.minHorizontalCollidingDistance(ps, ns) - (s->x() - ps->x());
                 if (ps == fs) {
                     ww = std::max(ww, ns->minLeft(ls) - s->x());
                 }
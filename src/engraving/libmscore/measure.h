@@ -31,6 +31,8 @@
 #include "measurebase.h"
 #include "segmentlist.h"
 
+#include "layout/segmentdistancecache.h"
+
 namespace mu::engraving::rw {
 class MeasureRW;
 }
@@ -371,8 +373,11 @@ public:
     void stretchMeasureInPracticeMode(double stretch);
     double squeezableSpace() const { return _squeezableSpace; }
 
+    void resetSegmentDistances() { m_segmentDistances.reset(); }
+
 private:
     double _squeezableSpace = 0;
+    SegmentDistanceCache m_segmentDistances;
     friend class Factory;
     friend class rw::MeasureRW;
 
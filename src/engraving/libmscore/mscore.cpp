@@ -108,15 +108,32 @@ int MScore::mtcType;
 
 bool MScore::noExcerpts = false;
 bool MScore::noImages = false;
-bool MScore::pdfPrinting = false;
-bool MScore::svgPrinting = false;
+thread_local bool MScore::pdfPrinting = false;
+thread_local bool MScore::svgPrinting = false;
 
-double MScore::pixelRatio  = 0.8;         // DPI / logicalDPI
+thread_local double MScore::pixelRatio  = 0.8;         // DPI / logicalDPI
 
 extern void initDrumset();
 
 MsError MScore::_error { MsError::MS_NO_ERROR };
 
+MScore::PaintingState MScore::paintingState()
+{
+    PaintingState state;
+    state.pdfPrinting = pdfPrinting;
+    state.svgPrinting = svgPrinting;
+    state.pixelRatio = pixelRatio;
+
+    return state;
+}
+
+void MScore::setPaintingState(const PaintingState& state)
+{
+    pdfPrinting = state.pdfPrinting;
+    svgPrinting = state.svgPrinting;
+    pixelRatio = state.pixelRatio;
+}
+
 //---------------------------------------------------------
 //   init
 //---------------------------------------------------------
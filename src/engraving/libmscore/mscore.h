@@ -275,9 +275,21 @@ public:
     static bool noExcerpts;
     static bool noImages;
 
-    static bool pdfPrinting;
-    static bool svgPrinting;
-    static double pixelRatio;
+    //! NOTE Set by the painting, per thread, because several scores may be painted (exported) at the same time
+    static thread_local bool pdfPrinting;
+    static thread_local bool svgPrinting;
+    static thread_local double pixelRatio;
+
+    //! NOTE The values above, a new thread starts with the defaults,
+    //! so a worker thread is given the ones of the thread that started it
+    struct PaintingState {
+        bool pdfPrinting = false;
+        bool svgPrinting = false;
+        double pixelRatio = 0.8;
+    };
+
+    static PaintingState paintingState();
+    static void setPaintingState(const PaintingState& state);
 
     static double verticalPageGap;
     static double horizontalPageGapEven;
@@ -22,6 +22,8 @@
 
 #include "page.h"
 
+#include <atomic>
+
 #include "style/style.h"
 #include "rw/xml.h"
 
@@ -63,7 +65,32 @@ static String revision;
 Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), _no(0)
 {
+    invalidateBspTree();
+}
+
+//---------------------------------------------------------
+//   invalidateBspTree
+//---------------------------------------------------------
+
+void Page::invalidateBspTree()
+{
+    //! NOTE Stamps are unique among all pages,
+    //! so a new page at the address of a deleted one doesn't look unchanged
+    static std::atomic<uint64_t> s_lastLayoutStamp = 0;
+
     bspTreeValid = false;
+    m_layoutStamp = ++s_lastLayoutStamp;
+}
+
+//---------------------------------------------------------
+//   rebuildBspTreeIfNeeded
+//---------------------------------------------------------
+
+void Page::rebuildBspTreeIfNeeded()
+{
+    if (!bspTreeValid) {
+        doRebuildBspTree();
+    }
 }
 
 //---------------------------------------------------------
@@ -53,6 +53,7 @@ class Page final : public EngravingItem
 
     BspTree bspTree;
     bool bspTreeValid;
+    uint64_t m_layoutStamp = 0;
 
     void doRebuildBspTree();
 
@@ -93,7 +94,15 @@ public:
 
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
-    void invalidateBspTree() { bspTreeValid = false; }
+    void invalidateBspTree();
+
+    //! NOTE The tree is otherwise built on the first items query after the page is laid out
+    void rebuildBspTreeIfNeeded();
+
+    //! NOTE Changes each time the page content is laid out or its visibility changes,
+    //! used to find out that cached paintings of the page are stale
+    uint64_t layoutStamp() const { return m_layoutStamp; }
+
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     mu::RectF tbbox();                             // tight bounding box, excluding white space
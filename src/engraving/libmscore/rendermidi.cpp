@@ -29,6 +29,8 @@
 
 #include <set>
 #include <cmath>
+#include <queue>
+#include <thread>
 
 #include "style/style.h"
 #include "compat/midi/event.h"
@@ -71,6 +73,8 @@
 
 #include "masterscore.h"
 
+#include "orderedtaskpool.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -686,7 +690,8 @@ static void renderHarmony(EventMap* events, Measure const* m, Harmony* h, int ti
     int staffIdx = static_cast<int>(staff->idx());
     int velocity = staff->velocities().val(h->tick());
 
-    RealizedHarmony r = h->getRealizedHarmony();
+    //! NOTE The harmony is realized by MidiRenderer::prepareScore(), here it's only read
+    const RealizedHarmony& r = h->getRealizedHarmony();
     std::vector<int> pitches = r.pitches();
 
     NPlayEvent ev(ME_NOTEON, static_cast<uint8_t>(channel->channel()), 0, velocity);
@@ -2284,9 +2289,52 @@ void Score::renderMidi(EventMap* events, bool metronome, bool expandRepeats, con
 void MidiRenderer::renderScore(EventMap* events, const Context& ctx)
 {
     updateState();
+    prepareScore();
+
+    //! NOTE The staff chunks only read the prepared score, so they are rendered concurrently
+    //! into separate maps: for each chunk one map per staff and one for the spanners and metronome.
+    //! The maps are merged in this order, that is the order the events were inserted in when rendering serially.
+    const std::vector<Staff*>& staves = score->staves();
+    const size_t partsPerChunk = staves.size() + 1;
+    std::vector<EventMap> parts(chunks.size() * partsPerChunk);
+
+    size_t threadCount = ctx.threadCount > 0 ? ctx.threadCount : std::thread::hardware_concurrency();
+    threadCount = std::min(threadCount, chunks.size() * staves.size());
+
+    OrderedTaskPool<EventMap> pool(threadCount, [&parts, &staves, partsPerChunk](size_t index, EventMap&& part) {
+        parts[(index / staves.size()) * partsPerChunk + index % staves.size()] = std::move(part);
+    }, 0, "midi_render");
+
+    const StaffContext baseContext = staffContext(ctx);
     for (const Chunk& chunk : chunks) {
-        renderChunk(chunk, events, ctx);
+        for (Staff* st : staves) {
+            pool.add([this, &chunk, st, baseContext]() {
+                StaffContext sctx = baseContext;
+                sctx.staff = st;
+
+                EventMap part;
+                renderStaffChunk(chunk, &part, sctx);
+                return part;
+            });
+        }
     }
+    pool.finish();
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        EventMap& part = parts[i * partsPerChunk + staves.size()];
+
+        // create sustain pedal events
+        renderSpanners(chunks[i], &part);
+
+        if (ctx.metronome) {
+            renderMetronome(chunks[i], &part);
+        }
+    }
+
+    mergeEvents(events, parts);
+
+    events->fixupMIDI();
+    removeDuplicateControllers(events);
 }
 
 void MidiRenderer::renderChunk(const Chunk& chunk, EventMap* events, const Context& ctx)
@@ -2297,6 +2345,31 @@ void MidiRenderer::renderChunk(const Chunk& chunk, EventMap* events, const Conte
     score->updateChannel();
     score->updateVelo();
 
+    // create note & other events
+    StaffContext sctx = staffContext(ctx);
+    for (Staff* st : score->staves()) {
+        sctx.staff = st;
+        renderStaffChunk(chunk, events, sctx);
+    }
+    events->fixupMIDI();
+
+    // create sustain pedal events
+    renderSpanners(chunk, events);
+
+    if (ctx.metronome) {
+        renderMetronome(chunk, events);
+    }
+
+    removeDuplicateControllers(events);
+}
+
+//---------------------------------------------------------
+//   MidiRenderer::staffContext
+///   Returns the rendering settings common for all staves
+//---------------------------------------------------------
+
+MidiRenderer::StaffContext MidiRenderer::staffContext(const Context& ctx) const
+{
     SynthesizerState s = score->synthesizerState();
     int method = s.method();
     int cc = s.ccToUse();
@@ -2331,24 +2404,106 @@ void MidiRenderer::renderChunk(const Chunk& chunk, EventMap* events, const Conte
         break;
     }
 
-    // create note & other events
+    StaffContext sctx;
+    sctx.method = renderMethod;
+    sctx.cc = cc;
+    sctx.renderHarmony = ctx.renderHarmony;
+    return sctx;
+}
+
+//---------------------------------------------------------
+//   MidiRenderer::prepareScore
+///   Updates everything inside score the staff chunks
+///   depend on, so that rendering them doesn't modify
+///   the score.
+//---------------------------------------------------------
+
+void MidiRenderer::prepareScore()
+{
+    std::set<std::pair<Measure const*, Measure const*> > prepared;
+    for (const Chunk& chunk : chunks) {
+        // chunks of repeated sections share the measures
+        if (prepared.insert({ chunk.startMeasure(), chunk.endMeasure() }).second) {
+            score->createPlayEvents(chunk.startMeasure(), chunk.endMeasure());
+        }
+    }
+
+    score->updateChannel();
+    score->updateVelo();
+
+    //! NOTE The repeat list and the change maps are updated lazily on reading.
+    //! The staff chunks use only the repeat list lookups that don't move its cached indices
+    //! (back(), findRepeatSegmentFromUTick()), so they don't write to it either
+    score->repeatList();
     for (Staff* st : score->staves()) {
-        StaffContext sctx;
-        sctx.staff = st;
-        sctx.method = renderMethod;
-        sctx.cc = cc;
-        sctx.renderHarmony = ctx.renderHarmony;
-        renderStaffChunk(chunk, events, sctx);
+        st->velocities().cleanup();
+        st->velocityMultiplications().cleanup();
     }
-    events->fixupMIDI();
 
-    // create sustain pedal events
-    renderSpanners(chunk, events);
+    //! NOTE The harmonies cache their realization on the first getRealizedHarmony(),
+    //! with expanded repeats the same harmony is rendered by several staff chunks at once
+    for (Segment* seg = score->firstSegment(SegmentType::ChordRest); seg; seg = seg->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : seg->annotations()) {
+            Harmony* h = nullptr;
+            if (e->isHarmony()) {
+                h = toHarmony(e);
+            } else if (e->isFretDiagram()) {
+                h = toFretDiagram(e)->harmony();
+            }
+            if (h && h->play()) {
+                h->getRealizedHarmony();
+            }
+        }
+    }
+}
 
-    if (ctx.metronome) {
-        renderMetronome(chunk, events);
+//---------------------------------------------------------
+//   MidiRenderer::mergeEvents
+///   Merges the sorted parts into events, the events
+///   at the same tick keep the order of the parts.
+//---------------------------------------------------------
+
+void MidiRenderer::mergeEvents(EventMap* events, std::vector<EventMap>& parts)
+{
+    struct Cursor {
+        EventMap::const_iterator it;
+        EventMap::const_iterator end;
+        size_t part = 0;
+
+        bool operator>(const Cursor& other) const
+        {
+            return it->first != other.it->first ? it->first > other.it->first : part > other.part;
+        }
+    };
+
+    std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor> > queue;
+    for (size_t i = 0; i < parts.size(); ++i) {
+        events->registerChannel(parts[i].highestChannel());
+        if (!parts[i].empty()) {
+            queue.push({ parts[i].cbegin(), parts[i].cend(), i });
+        }
     }
 
+    while (!queue.empty()) {
+        Cursor cursor = queue.top();
+        queue.pop();
+
+        events->emplace_hint(events->end(), cursor.it->first, cursor.it->second);
+
+        if (++cursor.it != cursor.end) {
+            queue.push(cursor);
+        } else {
+            parts[cursor.part].clear();
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   MidiRenderer::removeDuplicateControllers
+//---------------------------------------------------------
+
+void MidiRenderer::removeDuplicateControllers(EventMap* events)
+{
     // NOTE:JT this is a temporary fix for duplicate events until polyphonic aftertouch support
     // can be implemented. This removes duplicate SND events.
     int lastChannel = -1;
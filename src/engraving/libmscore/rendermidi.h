@@ -98,6 +98,17 @@ public:
         int utick2() const { return tick2() + tickOffset(); }
     };
 
+    struct Context
+    {
+        SynthesizerState synthState;
+        bool metronome{ true };
+        bool renderHarmony{ false };
+        //! NOTE Count of threads rendering the staff chunks in renderScore(), 0 means the count of cores
+        size_t threadCount{ 0 };
+
+        Context() {}
+    };
+
 private:
     std::vector<Chunk> chunks;
 
@@ -113,10 +124,15 @@ private:
     static bool canBreakChunk(const Measure* last);
     void updateState();
 
+    StaffContext staffContext(const Context& ctx) const;
+    void prepareScore();
+
     void renderStaffChunk(const Chunk&, EventMap* events, const StaffContext& sctx);
     void renderSpanners(const Chunk&, EventMap* events);
     void renderMetronome(const Chunk&, EventMap* events);
     void renderMetronome(EventMap* events, Measure const* m, const Fraction& tickOffset);
+    static void mergeEvents(EventMap* events, std::vector<EventMap>& parts);
+    static void removeDuplicateControllers(EventMap* events);
 
     void collectMeasureEvents(EventMap* events, Measure const* m, const MidiRenderer::StaffContext& sctx, int tickOffset);
     void collectMeasureEventsSimple(EventMap* events, Measure const* m, const StaffContext& sctx, int tickOffset);
@@ -125,15 +141,6 @@ private:
 public:
     explicit MidiRenderer(Score* s);
 
-    struct Context
-    {
-        SynthesizerState synthState;
-        bool metronome{ true };
-        bool renderHarmony{ false };
-
-        Context() {}
-    };
-
     void renderScore(EventMap* events, const Context& ctx);
     void renderChunk(const Chunk&, EventMap* events, const Context& ctx);
 
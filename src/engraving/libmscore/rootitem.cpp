@@ -47,9 +47,9 @@ compat::DummyElement* RootItem::dummy() const
 
 void RootItem::init()
 {
-#ifndef ENGRAVING_NO_ACCESSIBILITY
-    setupAccessible();
-#endif
+    //! NOTE The accessible root is made on demand, when an element of the score
+    //! becomes accessible or the score is shown with accessibility enabled (see NotationAccessibility),
+    //! so the excerpts nobody navigates and the headless conversions don't make it
 
     m_dummy->setParent(this);
     m_dummy->init();
@@ -40,6 +40,7 @@
 #include "types/translatablestring.h"
 #include "types/typesconv.h"
 #include "infrastructure/symbolfonts.h"
+#include "layout/textlayoutcache.h"
 
 #include "articulation.h"
 #include "audio.h"
@@ -1469,6 +1470,8 @@ static void updateStyle(void*, EngravingItem* e)
 
 void Score::styleChanged()
 {
+    TextLayoutCache::instance()->invalidate();
+
     scanElements(0, updateStyle);
     for (int i = 0; i < MAX_HEADERS; i++) {
         if (headerText(i)) {
@@ -5724,7 +5727,9 @@ void Score::setPos(POS pos, Fraction tick) { _masterScore->setPos(pos, tick); }
 //    Usually pushes and pops to the undo stack are only
 //    valid inside a startCmd() - endCmd(). Exceptions
 //    occurred during score loading.
+//    Counted per thread, because several scores
+//    may be loaded at the same time (batch conversion).
 //---------------------------------------------------------
 
-int ScoreLoad::_loading = 0;
+thread_local int ScoreLoad::_loading = 0;
 }
@@ -1265,7 +1265,7 @@ static inline const Score* toScore(const EngravingObject* e)
 
 class ScoreLoad
 {
-    static int _loading;
+    static thread_local int _loading;
 
 public:
     ScoreLoad() { ++_loading; }
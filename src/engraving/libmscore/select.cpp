@@ -430,6 +430,15 @@ void Selection::clear()
         return;
     }
 
+    //! NOTE A range selection refreshes the whole score, see deselectAll()
+    if (_state == SelState::RANGE) {
+        _score->setUpdateAll();
+        for (EngravingItem* e : _el) {
+            e->setSelected(false);
+        }
+        _el.clear();
+    }
+
     for (EngravingItem* e : _el) {
         if (e->isSpanner()) {       // TODO: only visible elements should be selectable?
             Spanner* sp = toSpanner(e);
@@ -480,13 +489,13 @@ void Selection::appendFiltered(EngravingItem* e)
     }
 }
 
-void Selection::appendChord(Chord* chord)
+void Selection::appendChord(Chord* chord, std::unordered_set<const Beam*>& appendedBeams)
 {
     IF_ASSERT_FAILED(!isLocked()) {
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    if (chord->beam() && !mu::contains(_el, static_cast<EngravingItem*>(chord->beam()))) {
+    if (chord->beam() && appendedBeams.insert(chord->beam()).second) {
         _el.push_back(chord->beam());
     }
     if (chord->stem()) {
@@ -588,14 +597,22 @@ void Selection::updateSelectedElements()
     track_idx_t startTrack = _staffStart * VOICES;
     track_idx_t endTrack   = _staffEnd * VOICES;
 
+    //! NOTE The segments are collected once instead of walking the segment list for every track
+    std::vector<Segment*> segments;
+    for (Segment* s = _startSegment; s && (s != _endSegment); s = s->next1MM()) {
+        if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
+            continue;
+        }
+        segments.push_back(s);
+    }
+
+    std::unordered_set<const Beam*> appendedBeams;
+
     for (track_idx_t st = startTrack; st < endTrack; ++st) {
         if (!canSelectVoice(st)) {
             continue;
         }
-        for (Segment* s = _startSegment; s && (s != _endSegment); s = s->next1MM()) {
-            if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
-                continue;
-            }
+        for (Segment* s : segments) {
             for (EngravingItem* e : s->annotations()) {
                 if (e->track() != st) {
                     continue;
@@ -618,10 +635,10 @@ void Selection::updateSelectedElements()
                 Chord* chord = toChord(e);
                 for (Chord* graceNote : chord->graceNotes()) {
                     if (canSelect(graceNote)) {
-                        appendChord(graceNote);
+                        appendChord(graceNote, appendedBeams);
                     }
                 }
-                appendChord(chord);
+                appendChord(chord, appendedBeams);
                 for (Articulation* art : chord->articulations()) {
                     appendFiltered(art);
                 }
@@ -739,6 +756,8 @@ void Selection::dump()
 
 void Selection::updateState()
 {
+    _typeCountsValid = false;
+
     size_t n = _el.size();
     EngravingItem* e = element();
     if (n == 0) {
@@ -762,6 +781,7 @@ void Selection::updateState()
 void Selection::setState(SelState s)
 {
     _state = s;
+    _typeCountsValid = false;
     _score->setSelectionChanged(true);
 }
 
@@ -1119,6 +1139,12 @@ std::vector<EngravingItem*> Selection::elements(ElementType type) const
 {
     std::vector<EngravingItem*> result;
 
+    size_t count = elementsCount(type);
+    if (count == 0) {
+        return result;
+    }
+
+    result.reserve(count);
     for (EngravingItem* element : _el) {
         if (element->type() == type) {
             result.push_back(element);
@@ -1128,6 +1154,26 @@ std::vector<EngravingItem*> Selection::elements(ElementType type) const
     return result;
 }
 
+//---------------------------------------------------------
+//   elementsCount
+//    the counts of all types are computed once
+//    for the current selection
+//---------------------------------------------------------
+
+size_t Selection::elementsCount(ElementType type) const
+{
+    if (!_typeCountsValid) {
+        _typeCounts.clear();
+        for (const EngravingItem* element : _el) {
+            ++_typeCounts[element->type()];
+        }
+        _typeCountsValid = true;
+    }
+
+    auto it = _typeCounts.find(type);
+    return it != _typeCounts.end() ? it->second : 0;
+}
+
 std::vector<Note*> Selection::noteList(track_idx_t selTrack) const
 {
     std::vector<Note*> nl;
@@ -1337,15 +1383,11 @@ const std::list<EngravingItem*> Selection::uniqueElements() const
 {
     std::list<EngravingItem*> l;
 
+    //! NOTE Linked elements share their links, so one of them is found by the links
+    std::unordered_set<const void*> added;
     for (EngravingItem* e : elements()) {
-        bool alreadyThere = false;
-        for (EngravingItem* ee : l) {
-            if ((ee->links() && ee->links()->contains(e)) || e == ee) {
-                alreadyThere = true;
-                break;
-            }
-        }
-        if (!alreadyThere) {
+        const void* key = e->links() ? static_cast<const void*>(e->links()) : static_cast<const void*>(e);
+        if (added.insert(key).second) {
             l.push_back(e);
         }
     }
@@ -1363,16 +1405,11 @@ std::list<Note*> Selection::uniqueNotes(track_idx_t track) const
 {
     std::list<Note*> l;
 
+    std::unordered_set<const void*> added;
     for (Note* nn : noteList(track)) {
         for (Note* note : nn->tiedNotes()) {
-            bool alreadyThere = false;
-            for (Note* n : l) {
-                if ((n->links() && n->links()->contains(note)) || n == note) {
-                    alreadyThere = true;
-                    break;
-                }
-            }
-            if (!alreadyThere) {
+            const void* key = note->links() ? static_cast<const void*>(note->links()) : static_cast<const void*>(note);
+            if (added.insert(key).second) {
                 l.push_back(note);
             }
         }
@@ -23,6 +23,9 @@
 #ifndef __SELECT_H__
 #define __SELECT_H__
 
+#include <map>
+#include <unordered_set>
+
 #include "pitchspelling.h"
 #include "mscore.h"
 #include "durationtype.h"
@@ -37,6 +40,7 @@ class Segment;
 class Note;
 class Measure;
 class Chord;
+class Beam;
 
 //---------------------------------------------------------
 //   ElementPattern
@@ -173,13 +177,16 @@ class Selection
 
     String _lockReason;
 
+    mutable std::map<ElementType, size_t> _typeCounts;    // cache of elementsCount()
+    mutable bool _typeCountsValid = false;
+
     mu::ByteArray staffMimeData() const;
     mu::ByteArray symbolListMimeData() const;
     SelectionFilter selectionFilter() const;
     bool canSelect(EngravingItem* e) const { return selectionFilter().canSelect(e); }
     bool canSelectVoice(track_idx_t track) const { return selectionFilter().canSelectVoice(track); }
     void appendFiltered(EngravingItem* e);
-    void appendChord(Chord* chord);
+    void appendChord(Chord* chord, std::unordered_set<const Beam*>& appendedBeams);
 
 public:
     Selection() { _score = 0; _state = SelState::NONE; }
@@ -199,6 +206,7 @@ public:
 
     const std::vector<EngravingItem*>& elements() const { return _el; }
     std::vector<EngravingItem*> elements(ElementType type) const;
+    size_t elementsCount(ElementType type) const;
     std::vector<Note*> noteList(track_idx_t track = mu::nidx) const;
 
     const std::list<EngravingItem*> uniqueElements() const;
@@ -54,14 +54,28 @@ void SpannerMap::update() const
 }
 
 //---------------------------------------------------------
-//   findContained
+//   updateIfDirty
+//    the tree may be queried from several threads at once
 //---------------------------------------------------------
 
-const std::vector<interval_tree::Interval<Spanner*> >& SpannerMap::findContained(int start, int stop) const
+void SpannerMap::updateIfDirty() const
 {
+    if (!dirty) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(updateMutex);
     if (dirty) {
         update();
     }
+}
+
+//---------------------------------------------------------
+//   findContained
+//---------------------------------------------------------
+
+const std::vector<interval_tree::Interval<Spanner*> >& SpannerMap::findContained(int start, int stop) const
+{
+    updateIfDirty();
     results.clear();
     tree.findContained(start, stop, results);
     return results;
@@ -73,14 +87,17 @@ const std::vector<interval_tree::Interval<Spanner*> >& SpannerMap::findContained
 
 const std::vector<interval_tree::Interval<Spanner*> >& SpannerMap::findOverlapping(int start, int stop) const
 {
-    if (dirty) {
-        update();
-    }
-    results.clear();
-    tree.findOverlapping(start, stop, results);
+    findOverlapping(start, stop, results);
     return results;
 }
 
+void SpannerMap::findOverlapping(int start, int stop, std::vector<interval_tree::Interval<Spanner*> >& result) const
+{
+    updateIfDirty();
+    result.clear();
+    tree.findOverlapping(start, stop, result);
+}
+
 //---------------------------------------------------------
 //   addSpanner
 //---------------------------------------------------------
@@ -23,7 +23,10 @@
 #ifndef __SPANNERMAP_H__
 #define __SPANNERMAP_H__
 
+#include <atomic>
 #include <map>
+#include <mutex>
+
 #include "thirdparty/intervaltree/IntervalTree.h"
 
 namespace mu::engraving {
@@ -35,10 +38,13 @@ class Spanner;
 
 class SpannerMap : std::multimap<int, Spanner*>
 {
-    mutable bool dirty;
+    mutable std::atomic<bool> dirty;
+    mutable std::mutex updateMutex;
     mutable interval_tree::IntervalTree<Spanner*> tree;
     mutable std::vector<interval_tree::Interval<Spanner*> > results;
 
+    void updateIfDirty() const;
+
 public:
     typedef typename std::multimap<int, Spanner*>::const_reverse_iterator const_reverse_it;
     typedef typename std::multimap<int, Spanner*>::const_iterator const_it;
@@ -47,6 +53,8 @@ public:
 
     const std::vector<interval_tree::Interval<Spanner*> >& findContained(int start, int stop) const;
     const std::vector<interval_tree::Interval<Spanner*> >& findOverlapping(int start, int stop) const;
+    //! NOTE Doesn't use the shared result buffer, so it may be called from several threads at once
+    void findOverlapping(int start, int stop, std::vector<interval_tree::Interval<Spanner*> >& result) const;
     const std::multimap<int, Spanner*>& map() const { return *this; }
     const_reverse_it crbegin() const { return std::multimap<int, Spanner*>::crbegin(); }
     const_reverse_it crend() const { return std::multimap<int, Spanner*>::crend(); }
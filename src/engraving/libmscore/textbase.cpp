@@ -32,6 +32,7 @@
 #include "types/translatablestring.h"
 #include "types/typesconv.h"
 #include "infrastructure/symbolfonts.h"
+#include "layout/textlayoutcache.h"
 
 #include "text.h"
 #include "textedit.h"
@@ -929,32 +930,53 @@ void TextBlock::layout(TextBase* t)
         _bbox |= temp;
         _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
     } else {
-        const auto fiLast = --_fragments.end();
-        for (auto fi = _fragments.begin(); fi != _fragments.end(); ++fi) {
-            TextFragment& f = *fi;
-            f.pos.setX(x);
-            mu::draw::FontMetrics fm(f.font(t));
-            if (f.format.valign() != VerticalAlignment::AlignNormal) {
-                double voffset = fm.xHeight() / subScriptSize;           // use original height
-                if (f.format.valign() == VerticalAlignment::AlignSubScript) {
-                    voffset *= subScriptOffset;
+        //! NOTE Reuse the geometry of the same line laid out before, only align it below
+        TextLayoutCache* cache = TextLayoutCache::instance();
+        TextLayoutCache::Key key(t, _fragments);
+        TextLayoutCache::Geometry geometry;
+        if (cache->find(key, geometry)) {
+            size_t idx = 0;
+            for (TextFragment& f : _fragments) {
+                f.pos = geometry.positions.at(idx++);
+            }
+            _bbox = geometry.bbox;
+            _lineSpacing = geometry.lineSpacing;
+        } else {
+            geometry.positions.reserve(_fragments.size());
+
+            const auto fiLast = --_fragments.end();
+            for (auto fi = _fragments.begin(); fi != _fragments.end(); ++fi) {
+                TextFragment& f = *fi;
+                f.pos.setX(x);
+                mu::draw::FontMetrics fm(f.font(t));
+                if (f.format.valign() != VerticalAlignment::AlignNormal) {
+                    double voffset = fm.xHeight() / subScriptSize;           // use original height
+                    if (f.format.valign() == VerticalAlignment::AlignSubScript) {
+                        voffset *= subScriptOffset;
+                    } else {
+                        voffset *= superScriptOffset;
+                    }
+                    f.pos.setY(voffset);
                 } else {
-                    voffset *= superScriptOffset;
+                    f.pos.setY(0.0);
                 }
-                f.pos.setY(voffset);
-            } else {
-                f.pos.setY(0.0);
-            }
 
-            // Optimization: don't calculate character position
-            // for the next fragment if there is no next fragment
-            if (fi != fiLast) {
-                const double w  = fm.width(f.text);
-                x += w;
+                // Optimization: don't calculate character position
+                // for the next fragment if there is no next fragment
+                if (fi != fiLast) {
+                    const double w  = fm.width(f.text);
+                    x += w;
+                }
+
+                _bbox   |= fm.tightBoundingRect(f.text).translated(f.pos);
+                _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
+
+                geometry.positions.push_back(f.pos);
             }
 
-            _bbox   |= fm.tightBoundingRect(f.text).translated(f.pos);
-            _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
+            geometry.bbox = _bbox;
+            geometry.lineSpacing = _lineSpacing;
+            cache->insert(key, geometry);
         }
     }
 
@@ -104,6 +104,14 @@ using namespace mu::engraving;
 namespace mu::engraving {
 extern Measure* tick2measure(int tick);
 
+// memory usage estimates
+static constexpr size_t LIST_NODE_SIZE = 3 * sizeof(void*);
+static constexpr size_t PROPERTY_DATA_SIZE = 64;    // shared data of a PropertyValue
+static constexpr size_t ITEM_SIZE = 512;            // an engraving item with its data
+
+// runs of ChangeProperty commands of at least this size are stored as ChangePropertyList
+static constexpr size_t MIN_COMPACTED_RUN = 4;
+
 static std::vector<const EngravingObject*> compoundObjects(const EngravingObject* object)
 {
     std::vector<const EngravingObject*> objects;
@@ -187,6 +195,36 @@ void UndoCommand::cleanup(bool undo)
     }
 }
 
+static size_t itemTreeMemoryUsage(const EngravingObject* item)
+{
+    size_t size = ITEM_SIZE;
+    for (const EngravingObject* child : item->scanChildren()) {
+        size += itemTreeMemoryUsage(child);
+    }
+    return size;
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//    An estimate, taken when the macro ends. The elements
+//    owned by the commands in that state (the removed ones)
+//    are counted with their children
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    return sizeof(UndoCommand) + childrenMemoryUsage();
+}
+
+size_t UndoCommand::childrenMemoryUsage() const
+{
+    size_t size = 0;
+    for (const UndoCommand* c : childList) {
+        size += LIST_NODE_SIZE + c->memoryUsage();
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -278,6 +316,77 @@ void UndoCommand::filterChildren(UndoCommand::Filter f, EngravingItem* target)
     childList = std::move(acceptedList);
 }
 
+//---------------------------------------------------------
+//   compactChildren
+///   Replace runs of ChangeProperty commands for the same
+///   property by ChangePropertyList commands.
+///   The order of the changes is kept.
+//---------------------------------------------------------
+
+void UndoCommand::compactChildren()
+{
+    auto isChangeProperty = [](const UndoCommand* cmd) {
+        return !strcmp(cmd->name(), "ChangeProperty");
+    };
+
+    std::list<UndoCommand*> compacted;
+    for (auto it = childList.begin(); it != childList.end();) {
+        if (!isChangeProperty(*it)) {
+            compacted.push_back(*it);
+            ++it;
+            continue;
+        }
+
+        const Pid id = static_cast<ChangeProperty*>(*it)->getId();
+        auto runEnd = std::next(it);
+        size_t runSize = 1;
+        while (runEnd != childList.end() && isChangeProperty(*runEnd) && static_cast<ChangeProperty*>(*runEnd)->getId() == id) {
+            ++runEnd;
+            ++runSize;
+        }
+
+        ChangePropertyList* list = nullptr;
+        if (!compacted.empty() && !strcmp(compacted.back()->name(), "ChangePropertyList")
+            && static_cast<ChangePropertyList*>(compacted.back())->getId() == id) {
+            list = static_cast<ChangePropertyList*>(compacted.back());
+        } else if (runSize >= MIN_COMPACTED_RUN) {
+            list = new ChangePropertyList(id);
+            compacted.push_back(list);
+        }
+
+        for (; it != runEnd; ++it) {
+            if (list) {
+                list->append(static_cast<ChangeProperty*>(*it));
+                delete *it;
+            } else {
+                compacted.push_back(*it);
+            }
+        }
+    }
+    childList = std::move(compacted);
+}
+
+//---------------------------------------------------------
+//   expandChildren
+///   Replace ChangePropertyList commands by the ChangeProperty
+///   commands they were made of, so that they can be
+///   filtered one by one.
+//---------------------------------------------------------
+
+void UndoCommand::expandChildren()
+{
+    std::list<UndoCommand*> expanded;
+    for (UndoCommand* cmd : childList) {
+        if (!strcmp(cmd->name(), "ChangePropertyList")) {
+            mu::join(expanded, static_cast<ChangePropertyList*>(cmd)->expand());
+            delete cmd;
+        } else {
+            expanded.push_back(cmd);
+        }
+    }
+    childList = std::move(expanded);
+}
+
 //---------------------------------------------------------
 //   unwind
 //---------------------------------------------------------
@@ -318,6 +427,55 @@ UndoStack::~UndoStack()
     DeleteAll(list);
 }
 
+//---------------------------------------------------------
+//   setMemoryBudget
+//---------------------------------------------------------
+
+void UndoStack::setMemoryBudget(size_t bytes)
+{
+    m_memoryBudget = bytes;
+    dropOldest();
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t UndoStack::memoryUsage() const
+{
+    size_t size = 0;
+    for (size_t s : memoryList) {
+        size += s;
+    }
+    return size;
+}
+
+//---------------------------------------------------------
+//   dropOldest
+//    drop the oldest macros until the history fits
+//    the memory budget, the last macro is always kept
+//---------------------------------------------------------
+
+void UndoStack::dropOldest()
+{
+    if (m_memoryBudget == 0) {
+        return;
+    }
+
+    size_t usage = memoryUsage();
+    while (usage > m_memoryBudget && curIdx > 1) {
+        UndoMacro* cmd = mu::takeFirst(list);
+        usage -= memoryList.front();
+        memoryList.erase(memoryList.begin());
+        stateList.erase(stateList.begin());
+        --curIdx;
+        ++droppedCount;
+
+        cmd->cleanup(true);
+        delete cmd;
+    }
+}
+
 //---------------------------------------------------------
 //   beginMacro
 //---------------------------------------------------------
@@ -355,6 +513,21 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
         LOG_UNDO() << cmd->name();
     }
 #endif
+    //! NOTE Consecutive changes of the same property of the same element are coalesced:
+    //! the previous command already keeps the value to restore on undo
+    if (!strcmp(cmd->name(), "ChangeProperty") && curCmd->childCount() > 0) {
+        const UndoCommand* prev = curCmd->commands().back();
+        if (!strcmp(prev->name(), "ChangeProperty")) {
+            const ChangeProperty* prevChange = static_cast<const ChangeProperty*>(prev);
+            const ChangeProperty* change = static_cast<const ChangeProperty*>(cmd);
+            if (prevChange->getElement() == change->getElement() && prevChange->getId() == change->getId()) {
+                cmd->redo(ed);
+                delete cmd;
+                return;
+            }
+        }
+    }
+
     curCmd->appendChild(cmd);
     cmd->redo(ed);
 }
@@ -385,6 +558,7 @@ void UndoStack::remove(size_t idx)
     // remove redo stack
     while (list.size() > curIdx) {
         UndoCommand* cmd = mu::takeLast(list);
+        memoryList.pop_back();
         stateList.pop_back();
         cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
         delete cmd;
@@ -392,6 +566,7 @@ void UndoStack::remove(size_t idx)
     }
     while (list.size() > idx) {
         UndoCommand* cmd = mu::takeLast(list);
+        memoryList.pop_back();
         stateList.pop_back();
         cmd->cleanup(true);
         delete cmd;
@@ -405,6 +580,14 @@ void UndoStack::remove(size_t idx)
 
 void UndoStack::mergeCommands(size_t startIdx)
 {
+    // the index counts the dropped macros, see getCurIdx()
+    if (startIdx < droppedCount) {
+        // the start macro was dropped to fit the memory budget, the rest must not be merged into an older one
+        LOGW() << "the start macro was dropped, nothing to merge";
+        return;
+    }
+
+    startIdx -= droppedCount;
     assert(startIdx <= curIdx);
 
     if (startIdx >= list.size()) {
@@ -417,6 +600,9 @@ void UndoStack::mergeCommands(size_t startIdx)
         startMacro->append(std::move(*list[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+
+    startMacro->compactChildren();
+    memoryList[startIdx] = startMacro->memoryUsage();
 }
 
 //---------------------------------------------------------
@@ -465,15 +651,22 @@ void UndoStack::endMacro(bool rollback)
         // remove redo stack
         while (list.size() > curIdx) {
             UndoCommand* cmd = mu::takeLast(list);
+            memoryList.pop_back();
             stateList.pop_back();
             cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
             delete cmd;
         }
+        curCmd->compactChildren();
         list.push_back(curCmd);
+        memoryList.push_back(curCmd->memoryUsage());
         stateList.push_back(nextState++);
         ++curIdx;
     }
     curCmd = 0;
+
+    if (!rollback) {
+        dropOldest();
+    }
 }
 
 //---------------------------------------------------------
@@ -487,7 +680,10 @@ void UndoStack::reopen()
     assert(curIdx > 0);
     --curIdx;
     curCmd = mu::takeAt(list, curIdx);
+    memoryList.erase(memoryList.begin() + curIdx);
     stateList.erase(stateList.begin() + curIdx);
+    // the reopened macro may be filtered, it is compacted again when it ends
+    curCmd->expandChildren();
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
     }
@@ -512,7 +708,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = static_cast<TextEditData*>(ed->getData(ed->element).get());
-        if (ted && ted->startUndoIdx == curIdx) {
+        if (ted && ted->startUndoIdx == getCurIdx()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -651,6 +847,13 @@ const UndoMacro::SelectionInfo& UndoMacro::redoSelectionInfo() const
     return m_redoSelectionInfo;
 }
 
+size_t UndoMacro::memoryUsage() const
+{
+    size_t size = sizeof(UndoMacro) + childrenMemoryUsage();
+    size += (m_undoSelectionInfo.elements.capacity() + m_redoSelectionInfo.elements.capacity()) * sizeof(EngravingItem*);
+    return size;
+}
+
 std::unordered_set<ElementType> UndoMacro::changedTypes() const
 {
     std::unordered_set<ElementType> result;
@@ -1013,6 +1216,16 @@ void RemoveElement::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   memoryUsage
+//    the removed element is owned by the command
+//---------------------------------------------------------
+
+size_t RemoveElement::memoryUsage() const
+{
+    return sizeof(RemoveElement) + (element ? itemTreeMemoryUsage(element) : 0) + childrenMemoryUsage();
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -2065,6 +2278,23 @@ std::vector<Clef*> InsertRemoveMeasures::getCourtesyClefs(Measure* m)
     return startClefs;
 }
 
+//---------------------------------------------------------
+//   measuresMemoryUsage
+//    the removed measures are owned by the command
+//---------------------------------------------------------
+
+size_t InsertRemoveMeasures::measuresMemoryUsage() const
+{
+    size_t size = 0;
+    for (const MeasureBase* m = fm; m; m = m->next()) {
+        size += itemTreeMemoryUsage(m);
+        if (m == lm) {
+            break;
+        }
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   insertMeasures
 //---------------------------------------------------------
@@ -2558,6 +2788,69 @@ std::vector<const EngravingObject*> ChangeProperty::objectItems() const
     return compoundObjects(element);
 }
 
+size_t ChangeProperty::memoryUsage() const
+{
+    return sizeof(ChangeProperty) + PROPERTY_DATA_SIZE + childrenMemoryUsage();
+}
+
+//---------------------------------------------------------
+//   ChangePropertyList
+//---------------------------------------------------------
+
+void ChangePropertyList::append(const ChangeProperty* cmd)
+{
+    assert(cmd->getId() == id);
+    entries.push_back({ cmd->getElement(), cmd->data(), cmd->getFlags() });
+}
+
+void ChangePropertyList::flipEntry(Entry& e)
+{
+    PropertyValue v = e.element->getProperty(id);
+    PropertyFlags ps = e.element->propertyFlags(id);
+
+    e.element->setProperty(id, e.property);
+    e.element->setPropertyFlags(id, e.flags);
+    e.property = v;
+    e.flags = ps;
+}
+
+void ChangePropertyList::undo(EditData*)
+{
+    for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+        flipEntry(*it);
+    }
+}
+
+void ChangePropertyList::redo(EditData*)
+{
+    for (Entry& e : entries) {
+        flipEntry(e);
+    }
+}
+
+std::list<UndoCommand*> ChangePropertyList::expand() const
+{
+    std::list<UndoCommand*> commands;
+    for (const Entry& e : entries) {
+        commands.push_back(new ChangeProperty(e.element, id, e.property, e.flags));
+    }
+    return commands;
+}
+
+std::vector<const EngravingObject*> ChangePropertyList::objectItems() const
+{
+    std::vector<const EngravingObject*> objects;
+    for (const Entry& e : entries) {
+        mu::join(objects, compoundObjects(e.element));
+    }
+    return objects;
+}
+
+size_t ChangePropertyList::memoryUsage() const
+{
+    return sizeof(ChangePropertyList) + entries.capacity() * (sizeof(Entry) + PROPERTY_DATA_SIZE);
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
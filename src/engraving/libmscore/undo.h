@@ -119,6 +119,7 @@ class UndoCommand
 protected:
     virtual void flip(EditData*) {}
     void appendChildren(UndoCommand*);
+    size_t childrenMemoryUsage() const;
 
 public:
     enum class Filter {
@@ -138,9 +139,12 @@ public:
     UndoCommand* removeChild() { return mu::takeLast(childList); }
     size_t childCount() const { return childList.size(); }
     void unwind();
+    void compactChildren();
+    void expandChildren();
     const std::list<UndoCommand*>& commands() const { return childList; }
     virtual std::vector<const EngravingObject*> objectItems() const { return {}; }
     virtual void cleanup(bool undo);
+    virtual size_t memoryUsage() const;
 // #ifndef QT_NO_DEBUG
     virtual const char* name() const { return "UndoCommand"; }
 // #endif
@@ -185,6 +189,8 @@ public:
     std::unordered_set<ElementType> changedTypes() const;
     std::vector<const EngravingItem*> changedElements() const;
 
+    size_t memoryUsage() const override;
+
     static bool canRecordSelectedElement(const EngravingItem* e);
 
     UNDO_NAME("UndoMacro");
@@ -209,12 +215,16 @@ class UndoStack
 {
     UndoMacro* curCmd;
     std::vector<UndoMacro*> list;
+    std::vector<size_t> memoryList;     // estimated memory usage of the macros in list
     std::vector<int> stateList;
     int nextState;
     int cleanState;
     size_t curIdx = 0;
+    size_t droppedCount = 0;            // number of the oldest macros dropped to fit the memory budget
+    size_t m_memoryBudget = 0;          // bytes, 0 - unlimited
 
     void remove(size_t idx);
+    void dropOldest();
 
 public:
     UndoStack();
@@ -231,7 +241,8 @@ public:
     bool canRedo() const { return curIdx < list.size(); }
     int state() const { return stateList[curIdx]; }
     bool isClean() const { return cleanState == state(); }
-    size_t getCurIdx() const { return curIdx; }
+    //! NOTE The index counts the dropped macros too, so it stays valid when the oldest macros are dropped
+    size_t getCurIdx() const { return droppedCount + curIdx; }
     bool empty() const { return !canUndo() && !canRedo(); }
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
@@ -243,6 +254,11 @@ public:
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    size_t memoryBudget() const { return m_memoryBudget; }
+    void setMemoryBudget(size_t bytes);
+    size_t memoryUsage() const;
+    size_t stepCount() const { return list.size(); }
 };
 
 //---------------------------------------------------------
@@ -723,6 +739,8 @@ public:
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
+    size_t memoryUsage() const override;
+
     UNDO_CHANGED_OBJECTS({ element });
 };
 
@@ -993,6 +1011,7 @@ class InsertRemoveMeasures : public UndoCommand
 protected:
     void removeMeasures();
     void insertMeasures();
+    size_t measuresMemoryUsage() const;
 
 public:
     InsertRemoveMeasures(MeasureBase* _fm, MeasureBase* _lm)
@@ -1014,6 +1033,7 @@ public:
         : InsertRemoveMeasures(m1, m2) {}
     virtual void undo(EditData*) override { insertMeasures(); }
     virtual void redo(EditData*) override { removeMeasures(); }
+    size_t memoryUsage() const override { return sizeof(RemoveMeasures) + measuresMemoryUsage() + childrenMemoryUsage(); }
     UNDO_NAME("RemoveMeasures")
 };
 
@@ -1302,6 +1322,7 @@ public:
     Pid getId() const { return id; }
     EngravingObject* getElement() const { return element; }
     PropertyValue data() const { return property; }
+    PropertyFlags getFlags() const { return flags; }
     UNDO_NAME("ChangeProperty")
 
     std::vector<const EngravingObject*> objectItems() const override;
@@ -1310,6 +1331,50 @@ public:
     {
         return f == UndoCommand::Filter::ChangePropertyLinked && mu::contains(target->linkList(), element);
     }
+
+    size_t memoryUsage() const override;
+};
+
+//---------------------------------------------------------
+//   ChangePropertyList
+//    Compact form of a run of ChangeProperty commands
+//    for the same property, e.g. after a range operation.
+//    Not filtered as a whole, a reopened macro is expanded
+//    back to ChangeProperty commands first
+//---------------------------------------------------------
+
+class ChangePropertyList : public UndoCommand
+{
+    OBJECT_ALLOCATOR(engraving, ChangePropertyList)
+
+    struct Entry {
+        EngravingObject* element = nullptr;
+        PropertyValue property;
+        PropertyFlags flags = PropertyFlags::NOSTYLE;
+    };
+
+    Pid id;
+    std::vector<Entry> entries;
+
+    void flipEntry(Entry& e);
+
+public:
+    ChangePropertyList(Pid i)
+        : id(i) {}
+
+    void undo(EditData*) override;
+    void redo(EditData*) override;
+
+    Pid getId() const { return id; }
+    void append(const ChangeProperty* cmd);
+    std::list<UndoCommand*> expand() const;
+    size_t size() const { return entries.size(); }
+
+    UNDO_NAME("ChangePropertyList")
+
+    std::vector<const EngravingObject*> objectItems() const override;
+
+    size_t memoryUsage() const override;
 };
 
 //---------------------------------------------------------
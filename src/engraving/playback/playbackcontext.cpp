@@ -41,10 +41,9 @@ using namespace mu::mpe;
 
 dynamic_level_t PlaybackContext::appliableDynamicLevel(const int nominalPositionTick) const
 {
-    for (auto it = m_dynamicsMap.rbegin(); it != m_dynamicsMap.rend(); ++it) {
-        if (it->first <= nominalPositionTick) {
-            return it->second;
-        }
+    auto it = m_dynamicsMap.upper_bound(nominalPositionTick);
+    if (it != m_dynamicsMap.begin()) {
+        return std::prev(it)->second;
     }
 
     return mpe::dynamicLevelFromType(mpe::DynamicType::Natural);
@@ -52,10 +51,9 @@ dynamic_level_t PlaybackContext::appliableDynamicLevel(const int nominalPosition
 
 ArticulationType PlaybackContext::persistentArticulationType(const int nominalPositionTick) const
 {
-    for (auto it = m_playTechniquesMap.rbegin(); it != m_playTechniquesMap.rend(); ++it) {
-        if (it->first <= nominalPositionTick) {
-            return it->second;
-        }
+    auto it = m_playTechniquesMap.upper_bound(nominalPositionTick);
+    if (it != m_playTechniquesMap.begin()) {
+        return std::prev(it)->second;
     }
 
     return mpe::ArticulationType::Standard;
@@ -166,7 +164,8 @@ void PlaybackContext::handleSpanners(const ID partId, const Score* score, const
         return;
     }
 
-    auto intervals = spannerMap.findOverlapping(segmentStartTick, segmentEndTick);
+    std::vector<interval_tree::Interval<Spanner*> > intervals;
+    spannerMap.findOverlapping(segmentStartTick, segmentEndTick, intervals);
     for (const auto& interval : intervals) {
         const Spanner* spanner = interval.value;
 
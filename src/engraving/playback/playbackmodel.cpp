@@ -22,6 +22,8 @@
 
 #include "playbackmodel.h"
 
+#include <thread>
+
 #include "libmscore/score.h"
 #include "libmscore/measure.h"
 #include "libmscore/repeatlist.h"
@@ -35,6 +37,7 @@
 
 #include "utils/pitchutils.h"
 
+#include "orderedtaskpool.h"
 #include "log.h"
 
 using namespace mu;
@@ -48,6 +51,9 @@ static const std::string CHORD_SYMBOLS_INSTRUMENT_ID("chord_symbols");
 const InstrumentTrackId PlaybackModel::METRONOME_TRACK_ID = { 999, METRONOME_INSTRUMENT_ID };
 const InstrumentTrackId PlaybackModel::CHORD_SYMBOLS_TRACK_ID = { 1000, CHORD_SYMBOLS_INSTRUMENT_ID };
 
+//! NOTE Smaller changes are rendered on the calling thread, starting the threads would take longer
+static constexpr size_t MIN_ITEMS_TO_RENDER_CONCURRENTLY = 512;
+
 static const Harmony* findChordSymbol(const EngravingItem* item)
 {
     if (item->isHarmony()) {
@@ -59,6 +65,15 @@ static const Harmony* findChordSymbol(const EngravingItem* item)
     return nullptr;
 }
 
+PlaybackModel::~PlaybackModel()
+{
+    //! NOTE The curves of the events are shared through a process-wide pool,
+    //!      drop the ones that were only used by this score
+    m_playbackDataMap.clear();
+    mpe::PitchCurve::purgePool();
+    mpe::ExpressionCurve::purgePool();
+}
+
 void PlaybackModel::load(Score* score)
 {
     if (!score || score->measures()->empty() || !score->lastMeasure()) {
@@ -75,13 +90,18 @@ void PlaybackModel::load(Score* score)
         TrackBoundaries trackRange = trackBoundaries(range);
 
         clearExpiredTracks();
-        clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
 
         InstrumentTrackIdSet oldTracks = existingTrackIdSet();
 
+        //! NOTE The whole contexts are only rebuilt if the change may affect them everywhere,
+        //! otherwise only the contexts of the parts having dynamics or playing techniques in the changed range
+        bool reloadContexts = hasToReloadContexts(range.changedTypes) || !range.isValidBoundary();
+
         ChangedTrackIdSet trackChanges;
-        update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
+        updateSetupData();
+        updateContext(trackRange.trackFrom, trackRange.trackTo, reloadContexts ? nullptr : &tickRange);
+        updateEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
 
         notifyAboutChanges(oldTracks, trackChanges);
     });
@@ -104,7 +124,6 @@ void PlaybackModel::reload()
     int tickTo = m_score->lastMeasure()->endTick().ticks();
 
     clearExpiredTracks();
-    clearExpiredContexts(trackFrom, trackTo);
 
     for (auto& pair : m_playbackDataMap) {
         pair.second.originEvents.clear();
@@ -250,6 +269,11 @@ async::Channel<InstrumentTrackId> PlaybackModel::trackRemoved() const
     return m_trackRemoved;
 }
 
+void PlaybackModel::setRenderingThreadCount(size_t count)
+{
+    m_renderingThreadCount = count;
+}
+
 void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                            ChangedTrackIdSet* trackChanges)
 {
@@ -285,25 +309,67 @@ void PlaybackModel::updateSetupData()
     }
 }
 
-void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t trackTo)
+void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t trackTo, const TickBoundaries* changedTicks)
 {
+    std::vector<const Part*> parts;
+
     for (const Part* part : m_score->parts()) {
         if (trackTo < part->startTrack() || trackFrom >= part->endTrack()) {
             continue;
         }
 
-        for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
-            PlaybackContext& ctx = m_playbackCtxMap[trackId];
-            ctx.update(trackId.partId, m_score);
+        if (changedTicks && !hasContextSources(part, changedTicks->tickFrom, changedTicks->tickTo)) {
+            bool hasContexts = true;
+            for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
+                hasContexts &= mu::contains(m_playbackCtxMap, trackId);
+            }
 
-            PlaybackData& trackData = m_playbackDataMap[trackId];
-            trackData.dynamicLevelMap = ctx.dynamicLevelMap(m_score);
+            if (hasContexts) {
+                continue;
+            }
+        }
+
+        parts.push_back(part);
+    }
+
+    //! NOTE The context is the same for all the instruments of a part, so it is built once per part
+    using PartContext = std::pair<PlaybackContext, DynamicLevelMap>;
+
+    size_t threadCount = renderingThreadCount(parts.size(), parts.size() * m_score->nmeasures());
+
+    OrderedTaskPool<PartContext> pool(threadCount, [this, &parts](size_t index, PartContext&& result) {
+        for (const InstrumentTrackId& trackId : parts[index]->instrumentTrackIdSet()) {
+            m_playbackCtxMap[trackId] = result.first;
+            m_playbackDataMap[trackId].dynamicLevelMap = result.second;
         }
+    }, 0, "playback_context");
+
+    //! NOTE The repeat list is rebuilt lazily on reading, once the score is changed,
+    //! so it's brought up to date here, the workers only read it
+    m_score->repeatList();
+
+    for (const Part* part : parts) {
+        pool.add([this, part]() {
+            PartContext result;
+            result.first.update(part->id(), m_score);
+            result.second = result.first.dynamicLevelMap(m_score);
+            return result;
+        });
     }
+
+    pool.finish();
 }
 
 void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                                  ChangedTrackIdSet* trackChanges)
+{
+    TrackItemsToRenderMap itemsMap;
+    collectItemsToRender(tickFrom, tickTo, trackFrom, trackTo, itemsMap, trackChanges);
+    renderItems(itemsMap);
+}
+
+void PlaybackModel::collectItemsToRender(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
+                                         TrackItemsToRenderMap& result, ChangedTrackIdSet* trackChanges)
 {
     std::set<ID> changedPartIdSet = m_score->partIdsFromRange(trackFrom, trackTo);
 
@@ -374,15 +440,22 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
 
                     const PlaybackContext& ctx = m_playbackCtxMap[trackId];
 
-                    ArticulationsProfilePtr profile = profilesRepository()->defaultProfile(m_playbackDataMap[trackId].setupData.category);
-                    if (!profile) {
+                    TrackItemsToRender& trackItems = result[trackId];
+                    if (!trackItems.profile) {
+                        trackItems.profile = profilesRepository()->defaultProfile(m_playbackDataMap[trackId].setupData.category);
+                    }
+
+                    if (!trackItems.profile) {
                         LOGE() << "unsupported instrument family: " << partId;
                         continue;
                     }
 
-                    m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
-                                      ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                                      m_playbackDataMap[trackId].originEvents);
+                    ItemToRender itemToRender;
+                    itemToRender.item = item;
+                    itemToRender.tickPositionOffset = tickPositionOffset;
+                    itemToRender.dynamicLevel = ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset);
+                    itemToRender.persistentArticulation = ctx.persistentArticulationType(segmentStartTick + tickPositionOffset);
+                    trackItems.items.push_back(itemToRender);
 
                     collectChangesTracks(trackId, trackChanges);
                 }
@@ -395,6 +468,77 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
     }
 }
 
+void PlaybackModel::renderItems(TrackItemsToRenderMap& itemsMap)
+{
+    std::vector<std::pair<PlaybackEventsMap*, const TrackItemsToRender*> > jobs;
+    size_t itemCount = 0;
+
+    for (const auto& pair : itemsMap) {
+        jobs.push_back({ &m_playbackDataMap[pair.first].originEvents, &pair.second });
+        itemCount += pair.second.items.size();
+    }
+
+    auto render = [this](const TrackItemsToRender& trackItems, PlaybackEventsMap& result) {
+        for (const ItemToRender& itemToRender : trackItems.items) {
+            m_renderer.render(itemToRender.item, itemToRender.tickPositionOffset, itemToRender.dynamicLevel,
+                              itemToRender.persistentArticulation, trackItems.profile, result);
+        }
+    };
+
+    size_t threadCount = renderingThreadCount(jobs.size(), itemCount);
+    if (threadCount <= 1) {
+        for (const auto& job : jobs) {
+            render(*job.second, *job.first);
+        }
+
+        return;
+    }
+
+    //! NOTE Each track writes only its own events, so the tracks are rendered concurrently into separate maps,
+    //! which are added to the track data on this thread
+    OrderedTaskPool<PlaybackEventsMap> pool(threadCount, [&jobs](size_t index, PlaybackEventsMap&& events) {
+        PlaybackEventsMap& originEvents = *jobs[index].first;
+
+        for (auto& pair : events) {
+            PlaybackEventList& list = originEvents[pair.first];
+
+            if (list.empty()) {
+                list = std::move(pair.second);
+            } else {
+                list.insert(list.end(), std::make_move_iterator(pair.second.begin()), std::make_move_iterator(pair.second.end()));
+            }
+        }
+    }, 0, "playback_render");
+
+    //! NOTE See updateContext()
+    m_score->repeatList();
+
+    for (const auto& job : jobs) {
+        const TrackItemsToRender* trackItems = job.second;
+
+        pool.add([render, trackItems]() {
+            PlaybackEventsMap events;
+            render(*trackItems, events);
+            return events;
+        });
+    }
+
+    pool.finish();
+}
+
+size_t PlaybackModel::renderingThreadCount(const size_t jobCount, const size_t itemCount) const
+{
+    if (m_renderingThreadCount > 0) {
+        return std::min(m_renderingThreadCount, jobCount);
+    }
+
+    if (itemCount < MIN_ITEMS_TO_RENDER_CONCURRENTLY) {
+        return 1;
+    }
+
+    return std::min(static_cast<size_t>(std::thread::hardware_concurrency()), jobCount);
+}
+
 bool PlaybackModel::hasToReloadTracks(const std::unordered_set<ElementType>& changedTypes) const
 {
     static const std::unordered_set<ElementType> REQUIRED_TYPES = {
@@ -435,6 +579,51 @@ bool PlaybackModel::hasToReloadScore(const std::unordered_set<ElementType>& chan
     return false;
 }
 
+bool PlaybackModel::hasToReloadContexts(const std::unordered_set<ElementType>& changedTypes) const
+{
+    //! NOTE Changing the length of the measures moves all the dynamics after them
+    static const std::unordered_set<ElementType> REQUIRED_TYPES = {
+        ElementType::MEASURE, ElementType::TIMESIG
+    };
+
+    if (hasToReloadTracks(changedTypes) || hasToReloadScore(changedTypes)) {
+        return true;
+    }
+
+    for (const ElementType type : REQUIRED_TYPES) {
+        if (changedTypes.find(type) != changedTypes.cend()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool PlaybackModel::hasContextSources(const Part* part, const int tickFrom, const int tickTo) const
+{
+    //! NOTE A dynamic may be applied to the next segment of its measure,
+    //! so the whole measures of the range are checked
+    for (const Measure* measure = m_score->tick2measure(Fraction::fromTicks(tickFrom)); measure; measure = measure->nextMeasure()) {
+        if (measure->tick().ticks() > tickTo) {
+            break;
+        }
+
+        for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
+            for (const EngravingItem* annotation : segment->annotations()) {
+                if (!annotation || annotation->part() != part) {
+                    continue;
+                }
+
+                if (annotation->isDynamic() || annotation->isPlayTechAnnotation()) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
 bool PlaybackModel::containsTrack(const InstrumentTrackId& trackId) const
 {
     return m_playbackDataMap.find(trackId) != m_playbackDataMap.cend();
@@ -476,20 +665,6 @@ void PlaybackModel::clearExpiredTracks()
     }
 }
 
-void PlaybackModel::clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo)
-{
-    for (const Part* part : m_score->parts()) {
-        if (part->startTrack() > trackTo || part->endTrack() <= trackFrom) {
-            continue;
-        }
-
-        for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
-            PlaybackContext& ctx = m_playbackCtxMap[trackId];
-            ctx.clear();
-        }
-    }
-}
-
 void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo)
 {
     timestamp_t timestampFrom = timestampFromTicks(m_score, tickFrom);
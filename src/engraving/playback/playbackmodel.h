@@ -46,6 +46,7 @@ class Note;
 class EngravingItem;
 class Segment;
 class Instrument;
+class Part;
 class RepeatList;
 
 class PlaybackModel : public async::Asyncable
@@ -53,6 +54,8 @@ class PlaybackModel : public async::Asyncable
     INJECT(engraving, mpe::IArticulationProfilesRepository, profilesRepository)
 
 public:
+    ~PlaybackModel();
+
     void load(Score* score);
     void reload();
 
@@ -72,6 +75,9 @@ public:
     async::Channel<InstrumentTrackId> trackAdded() const;
     async::Channel<InstrumentTrackId> trackRemoved() const;
 
+    //! NOTE Count of threads rendering the tracks, 0 means the count of cores for large enough changes
+    void setRenderingThreadCount(size_t count);
+
 private:
     static const InstrumentTrackId METRONOME_TRACK_ID;
     static const InstrumentTrackId CHORD_SYMBOLS_TRACK_ID;
@@ -90,22 +96,43 @@ private:
         track_idx_t trackTo = mu::nidx;
     };
 
+    struct ItemToRender
+    {
+        const EngravingItem* item = nullptr;
+        int tickPositionOffset = 0;
+        mpe::dynamic_level_t dynamicLevel = 0;
+        mpe::ArticulationType persistentArticulation = mpe::ArticulationType::Undefined;
+    };
+
+    struct TrackItemsToRender
+    {
+        mpe::ArticulationsProfilePtr profile;
+        std::vector<ItemToRender> items;
+    };
+
+    using TrackItemsToRenderMap = std::unordered_map<InstrumentTrackId, TrackItemsToRender>;
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const ID& partId, const std::string& instrumentId) const;
 
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                 ChangedTrackIdSet* trackChanges = nullptr);
     void updateSetupData();
-    void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
+    void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo, const TickBoundaries* changedTicks = nullptr);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
+    void collectItemsToRender(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
+                              TrackItemsToRenderMap& result, ChangedTrackIdSet* trackChanges);
+    void renderItems(TrackItemsToRenderMap& itemsMap);
+    size_t renderingThreadCount(const size_t jobCount, const size_t itemCount) const;
 
     bool hasToReloadTracks(const std::unordered_set<ElementType>& changedTypes) const;
     bool hasToReloadScore(const std::unordered_set<ElementType>& changedTypes) const;
+    bool hasToReloadContexts(const std::unordered_set<ElementType>& changedTypes) const;
+    bool hasContextSources(const Part* part, const int tickFrom, const int tickTo) const;
 
     bool containsTrack(const InstrumentTrackId& trackId) const;
     void clearExpiredTracks();
-    void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
     void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
@@ -119,6 +146,7 @@ private:
 
     Score* m_score = nullptr;
     bool m_expandRepeats = true;
+    size_t m_renderingThreadCount = 0;
 
     PlaybackEventsRenderer m_renderer;
     PlaybackSetupDataResolver m_setupResolver;
@@ -22,13 +22,21 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "libmscore/masterscore.h"
 #include "libmscore/engravingitem.h"
 #include "libmscore/factory.h"
+#include "libmscore/rootitem.h"
+#include "compat/dummyelement.h"
 
 #include "utils/scorerw.h"
 #include "engraving/compat/scoreaccess.h"
 
+#include "mocks/engravingconfigurationmock.h"
+
+#include "log.h"
+
 using namespace mu::engraving;
 
 class Engraving_ElementTests : public ::testing::Test
@@ -104,3 +112,44 @@ TEST_F(Engraving_ElementTests, DISABLED_testIds)
         delete ee;
     }
 }
+
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+TEST_F(Engraving_ElementTests, Accessibility_NoAccessibleOnLoad)
+{
+    auto loadTime = [](bool accessibleEnabled) {
+        std::shared_ptr<testing::NiceMock<EngravingConfigurationMock> > configuration
+            = std::make_shared<testing::NiceMock<EngravingConfigurationMock> >();
+        ON_CALL(*configuration, isAccessibleEnabled()).WillByDefault(testing::Return(accessibleEnabled));
+        ON_CALL(*configuration, defaultColor()).WillByDefault(testing::Return(mu::draw::Color::black));
+
+        std::shared_ptr<IEngravingConfiguration> prevConfiguration = EngravingItem::engravingConfiguration();
+        EngravingItem::setengravingConfiguration(configuration);
+
+        auto start = std::chrono::steady_clock::now();
+        MasterScore* score = ScoreRW::readScore(u"all_elements_data/moonlight.mscx");
+        auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+        EXPECT_TRUE(score);
+        if (score) {
+            //! NOTE The accessible items are made on demand, when a score is shown or an element is selected
+            EXPECT_FALSE(score->rootItem()->accessible());
+            EXPECT_FALSE(score->dummy()->rootItem()->accessible());
+            EXPECT_FALSE(score->dummy()->accessible());
+            delete score;
+        }
+
+        EngravingItem::setengravingConfiguration(prevConfiguration);
+
+        return time;
+    };
+
+    //! [GIVEN] Accessibility disabled and enabled
+    //! [WHEN] Load a score
+    //! [THEN] No accessible objects are made, so loading takes about the same time
+    auto disabledTime = loadTime(false);
+    auto enabledTime = loadTime(true);
+
+    LOGI() << "load time, accessibility disabled: " << disabledTime << " ms, enabled: " << enabledTime << " ms";
+}
+
+#endif
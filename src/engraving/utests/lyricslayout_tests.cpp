@@ -0,0 +1,159 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+#include "modularity/ioc.h"
+#include "draw/internal/qfontprovider.h"
+
+#include "layout/textlayoutcache.h"
+
+#include "libmscore/chordrest.h"
+#include "libmscore/factory.h"
+#include "libmscore/lyrics.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/segment.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String LYRICS_LAYOUT_DATA_DIR(u"all_elements_data/");
+
+class Engraving_LyricsLayoutTests : public ::testing::Test
+{
+};
+
+//! NOTE Adds the given count of verses to every chord and rest of the score
+static void addLyrics(MasterScore* score, int verses)
+{
+    static const std::vector<String> SYLLABLES = {
+        u"A", u"ve", u"Ma", u"ri", u"a", u"gra", u"ti", u"a", u"ple", u"na", u"Do", u"mi", u"nus", u"te", u"cum"
+    };
+
+    size_t syllable = 0;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (track_idx_t track = 0; track < score->ntracks(); track += VOICES) {
+            ChordRest* cr = toChordRest(s->element(track));
+            if (!cr) {
+                continue;
+            }
+
+            for (int verse = 0; verse < verses; ++verse) {
+                Lyrics* l = Factory::createLyrics(cr);
+                l->setXmlText(SYLLABLES.at(syllable++ % SYLLABLES.size()));
+                l->setNo(verse);
+                l->setTrack(track);
+                cr->add(l);
+            }
+        }
+    }
+}
+
+static void collectLyricsLayout(void* data, EngravingItem* item)
+{
+    if (!item->isLyrics()) {
+        return;
+    }
+
+    std::vector<RectF>* layout = static_cast<std::vector<RectF>*>(data);
+    layout->push_back(item->pageBoundingRect());
+}
+
+/**
+ * @brief Engraving_LyricsLayoutTests_Benchmark_FontMetricsCache
+ * @details Lays out a lyrics dense score several times without the caches, with the font metrics cache
+ *          and with the text layout cache too, prints the time of each and checks that the lyrics are laid out the same way
+ */
+TEST_F(Engraving_LyricsLayoutTests, Benchmark_FontMetricsCache)
+{
+    constexpr int VERSES = 4;
+    constexpr int LAYOUT_PASSES = 5;
+
+    std::shared_ptr<draw::QFontProvider> fontProvider
+        = std::dynamic_pointer_cast<draw::QFontProvider>(modularity::ioc()->resolve<draw::IFontProvider>("utests"));
+    ASSERT_TRUE(fontProvider);
+
+    // [GIVEN] A score with lyrics on every chord and rest
+    MasterScore* score = ScoreRW::readScore(LYRICS_LAYOUT_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+    addLyrics(score, VERSES);
+
+    //! NOTE The text layout cache is dropped before each pass unless it's measured too,
+    //! otherwise the lines taken from it don't need the font metrics at all
+    auto layout = [score, fontProvider](bool metricsCacheEnabled, bool textLayoutCacheEnabled, std::vector<RectF>& lyricsLayout) {
+        fontProvider->clearMetricsCache();
+        fontProvider->setMetricsCacheEnabled(metricsCacheEnabled);
+        TextLayoutCache::instance()->invalidate();
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < LAYOUT_PASSES; ++pass) {
+            if (!textLayoutCacheEnabled) {
+                TextLayoutCache::instance()->invalidate();
+            }
+            score->doLayout();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        score->scanElements(&lyricsLayout, collectLyricsLayout, true);
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+    };
+
+    // [WHEN] The score is laid out without the caches, with the font metrics cache and with both caches
+    std::vector<RectF> uncachedLayout;
+    int64_t uncachedMs = layout(false, false, uncachedLayout);
+
+    std::vector<RectF> cachedLayout;
+    int64_t cachedMs = layout(true, false, cachedLayout);
+    draw::FontMetricsCache::Stats stats = fontProvider->metricsCacheStats();
+
+    std::vector<RectF> textCachedLayout;
+    TextLayoutCache::Stats textStatsBefore = TextLayoutCache::instance()->stats();
+    int64_t textCachedMs = layout(true, true, textCachedLayout);
+    TextLayoutCache::Stats textStats = TextLayoutCache::instance()->stats();
+    uint64_t textHits = textStats.hits - textStatsBefore.hits;
+    uint64_t textMisses = textStats.misses - textStatsBefore.misses;
+
+    LOGI() << "lyrics: " << cachedLayout.size() << ", layout passes: " << LAYOUT_PASSES
+           << ", without caches: " << uncachedMs << " ms, with font metrics cache: " << cachedMs << " ms"
+           << " (hits: " << stats.hits << ", misses: " << stats.misses << ", hit rate: " << stats.hitRate() << ")"
+           << ", with text layout cache too: " << textCachedMs << " ms"
+           << " (hits: " << textHits << ", misses: " << textMisses << ")";
+
+    // [THEN] The lyrics are laid out the same way and the most values are taken from the caches
+    EXPECT_FALSE(cachedLayout.empty());
+    EXPECT_EQ(cachedLayout, uncachedLayout);
+    EXPECT_EQ(textCachedLayout, uncachedLayout);
+    EXPECT_GT(stats.hitRate(), 0.9);
+    EXPECT_GT(textHits, textMisses);
+
+    fontProvider->setMetricsCacheEnabled(true);
+
+    delete score;
+}
@@ -38,6 +38,8 @@
 #include "libmscore/system.h"
 #include "libmscore/durationtype.h"
 
+#include "layout/segmentdistancecache.h"
+
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 
@@ -560,3 +562,61 @@ TEST_F(Engraving_MeasureTests, measureNumbers)
 
     delete score;
 }
+
+/**
+ * @brief Engraving_MeasureTests_segmentDistanceCache
+ * @details Checks that the cached distances between the segments match the computed ones,
+ *          that they are reused during the layout, and that a change of the shapes invalidates them
+ */
+TEST_F(Engraving_MeasureTests, segmentDistanceCache)
+{
+    MasterScore* score = ScoreRW::readScore(u"all_elements_data/moonlight.mscx");
+    EXPECT_TRUE(score);
+
+    // [WHEN] The score is laid out again
+    const SegmentDistanceCache::Stats statsBefore = SegmentDistanceCache::stats();
+    score->doLayout();
+
+    // [THEN] The distances are computed once and reused for the other stretches
+    const SegmentDistanceCache::Stats stats = SegmentDistanceCache::stats();
+    EXPECT_GT(stats.hits, statsBefore.hits);
+    EXPECT_GT(stats.misses, statsBefore.misses);
+
+    // [THEN] The cached distances are the same as the computed ones
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        SegmentDistanceCache cache;
+        cache.validate(m);
+
+        for (Segment* s = m->first(); s; s = s->next()) {
+            Segment* ns = s->nextActive();
+            if (!ns) {
+                continue;
+            }
+
+            EXPECT_EQ(cache.minHorizontalDistance(s, ns), s->minHorizontalDistance(ns, false));
+            EXPECT_EQ(cache.minHorizontalDistance(s, ns), s->minHorizontalDistance(ns, false));
+            EXPECT_EQ(cache.minHorizontalCollidingDistance(s, ns), s->minHorizontalCollidingDistance(ns));
+        }
+    }
+
+    // [WHEN] A shape of a segment gets wider
+    Measure* m = score->firstMeasure();
+    Segment* s = m->first(SegmentType::ChordRest);
+    Segment* ns = s->nextActive();
+    ASSERT_TRUE(ns);
+
+    SegmentDistanceCache cache;
+    cache.validate(m);
+    double distance = cache.minHorizontalDistance(s, ns);
+
+    Shape& shape = s->staffShape(0);
+    ASSERT_FALSE(shape.empty());
+    shape.add(RectF(shape.right(), shape.top(), 10 * score->spatium(), shape.bottom() - shape.top()));
+
+    // [THEN] The distance is computed again
+    cache.validate(m);
+    EXPECT_EQ(cache.minHorizontalDistance(s, ns), s->minHorizontalDistance(ns, false));
+    EXPECT_GT(cache.minHorizontalDistance(s, ns), distance);
+
+    delete score;
+}
@@ -67,6 +67,9 @@ public:
     MOCK_METHOD(async::Notification, debuggingOptionsChanged, (), (const, override));
 
     MOCK_METHOD(bool, isAccessibleEnabled, (), (const, override));
+
+    MOCK_METHOD(size_t, undoMemoryBudget, (), (const, override));
+    MOCK_METHOD(async::Channel<size_t>, undoMemoryBudgetChanged, (), (const, override));
 };
 }
 
@@ -0,0 +1,124 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/mscore.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String PARALLEL_LOAD_DATA_DIR(u"all_elements_data/");
+
+class Engraving_ParallelLoadTests : public ::testing::Test
+{
+};
+
+static void collectLayout(void* data, EngravingItem* item)
+{
+    std::vector<String>* layout = static_cast<std::vector<String>*>(data);
+
+    PointF pos = item->pagePos();
+    RectF bbox = item->bbox();
+    layout->push_back(String(u"%1 %2 %3 %4 %5 %6 %7").arg(String::fromAscii(item->typeName()))
+                      .arg(pos.x()).arg(pos.y())
+                      .arg(bbox.x()).arg(bbox.y()).arg(bbox.width()).arg(bbox.height()));
+}
+
+//! NOTE Reads and lays out the score, returns the type and the geometry of every item
+static std::vector<String> loadLayout(const String& fileName)
+{
+    std::vector<String> layout;
+
+    MasterScore* score = ScoreRW::readScore(PARALLEL_LOAD_DATA_DIR + fileName);
+    EXPECT_TRUE(score);
+    if (!score) {
+        return layout;
+    }
+
+    for (Score* s : score->scoreList()) {
+        s->scanElements(&layout, collectLayout, true);
+    }
+
+    delete score;
+
+    return layout;
+}
+
+/**
+ * @brief Engraving_ParallelLoadTests_SerialAndParallel_SameLayout
+ * @details The painting values (ex. MScore::pixelRatio) are per thread and the text layout depends on them,
+ *          so the worker threads are given the values of the main thread. The scores loaded on the workers
+ *          at the same time must be laid out exactly like the ones loaded one by one on the main thread
+ */
+TEST_F(Engraving_ParallelLoadTests, SerialAndParallel_SameLayout)
+{
+    constexpr size_t THREAD_COUNT = 4;
+    const std::vector<String> FILES = { u"moonlight.mscx", u"layout_elements.mscx" };
+
+    // [GIVEN] The pixel ratio of the main thread is not the default one, like in the app
+    MScore::PaintingState defaultState = MScore::paintingState();
+    MScore::PaintingState state = defaultState;
+    state.pixelRatio = DPI / 96.0;
+    MScore::setPaintingState(state);
+
+    // [WHEN] The scores are loaded one by one on the main thread
+    std::vector<std::vector<String> > serialLayouts;
+    for (const String& file : FILES) {
+        serialLayouts.push_back(loadLayout(file));
+        EXPECT_FALSE(serialLayouts.back().empty());
+    }
+
+    // [WHEN] The scores are loaded at the same time on the worker threads
+    std::vector<std::vector<std::vector<String> > > parallelLayouts(THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&FILES, &parallelLayouts, state, t]() {
+            MScore::setPaintingState(state);
+            for (const String& file : FILES) {
+                parallelLayouts[t].push_back(loadLayout(file));
+            }
+        });
+    }
+
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    MScore::setPaintingState(defaultState);
+
+    // [THEN] Every item is laid out the same way
+    for (size_t t = 0; t < THREAD_COUNT; ++t) {
+        ASSERT_EQ(parallelLayouts[t].size(), serialLayouts.size());
+        for (size_t f = 0; f < FILES.size(); ++f) {
+            EXPECT_EQ(parallelLayouts[t][f], serialLayouts[f]) << "thread: " << t << ", file: " << FILES[f].toStdString();
+        }
+    }
+}
@@ -692,3 +692,45 @@ TEST_F(Engraving_PlaybackModelTests, Playback_Setup_Data_MultiInstrument)
         }
     }
 }
+
+/**
+ * @brief PlaybackModelTests_Concurrent_Rendering
+ * @details In this case we're loading a freshly read score with 12 instruments twice - first rendering the tracks
+ *          on several threads, while the lazily updated data of the score (e.g. the repeat list) is not built yet,
+ *          then on one thread. The rendered events of every track must be the same
+ */
+TEST_F(Engraving_PlaybackModelTests, Concurrent_Rendering)
+{
+    // [GIVEN] Freshly read score with 12 instruments, its repeat list is to be rebuilt on the next reading
+    Score* score = ScoreRW::readScore(
+        PLAYBACK_MODEL_TEST_FILES_DIR + "playback_setup_instruments/playback_setup_instruments.mscx");
+
+    ASSERT_TRUE(score);
+    score->masterScore()->setPlaylistDirty();
+
+    // [GIVEN] The articulation profiles repository will be returning the default profile
+    EXPECT_CALL(*m_repositoryMock, defaultProfile(_)).WillRepeatedly(Return(m_defaultProfile));
+
+    // [WHEN] The playback model is loaded on several threads
+    PlaybackModel concurrentModel;
+    concurrentModel.setprofilesRepository(m_repositoryMock);
+    concurrentModel.setRenderingThreadCount(4);
+    concurrentModel.load(score);
+
+    // [WHEN] The playback model is loaded on one thread
+    PlaybackModel serialModel;
+    serialModel.setprofilesRepository(m_repositoryMock);
+    serialModel.setRenderingThreadCount(1);
+    serialModel.load(score);
+
+    // [THEN] The tracks are the same
+    ASSERT_EQ(serialModel.existingTrackIdSet(), concurrentModel.existingTrackIdSet());
+
+    for (const InstrumentTrackId& trackId : serialModel.existingTrackIdSet()) {
+        const PlaybackData& expected = serialModel.resolveTrackPlaybackData(trackId);
+        const PlaybackData& actual = concurrentModel.resolveTrackPlaybackData(trackId);
+
+        EXPECT_FALSE(actual.dynamicLevelMap.empty());
+        EXPECT_TRUE(expected == actual);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compat/midi/event.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/rendermidi.h"
+#include "libmscore/repeatlist.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String RENDERMIDI_DATA_DIR(u"all_elements_data/");
+
+class Engraving_RenderMidiTests : public ::testing::Test
+{
+public:
+    static EventMap render(Score* score, size_t threadCount)
+    {
+        MidiRenderer::Context ctx;
+        ctx.metronome = true;
+        ctx.renderHarmony = true;
+        ctx.threadCount = threadCount;
+
+        EventMap events;
+        MidiRenderer(score).renderScore(&events, ctx);
+        return events;
+    }
+
+    static void compare(const EventMap& expected, const EventMap& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        EXPECT_EQ(expected.highestChannel(), actual.highestChannel());
+
+        auto it = actual.cbegin();
+        for (const auto& pair : expected) {
+            EXPECT_EQ(pair.first, it->first);
+            EXPECT_TRUE(pair.second == it->second);
+            EXPECT_EQ(pair.second.getOriginatingStaff(), it->second.getOriginatingStaff());
+            EXPECT_EQ(pair.second.discard(), it->second.discard());
+            EXPECT_EQ(pair.second.note(), it->second.note());
+            ++it;
+        }
+    }
+};
+
+/**
+ * @brief Engraving_RenderMidiTests_ConcurrentMatchesSerial
+ * @details Renders the staff chunks on several threads and checks,
+ *          that the events and their order are the same as when rendering on one thread
+ */
+TEST_F(Engraving_RenderMidiTests, ConcurrentMatchesSerial)
+{
+    for (const String& name : { u"moonlight.mscx", u"layout_elements.mscx" }) {
+        MasterScore* score = ScoreRW::readScore(RENDERMIDI_DATA_DIR + name);
+        ASSERT_TRUE(score);
+
+        EventMap serial = render(score, 1);
+        EXPECT_FALSE(serial.empty());
+
+        EventMap concurrent = render(score, 4);
+        compare(serial, concurrent);
+
+        delete score;
+    }
+}
+
+/**
+ * @brief Engraving_RenderMidiTests_ScoreMatchesChunks
+ * @details Checks, that rendering the whole score gives the same events
+ *          as rendering it chunk by chunk, the way the score was rendered before:
+ *          fixupMIDI() after the notes of each chunk, then the spanners and the metronome of the chunk.
+ *          The scores have pedals, chord symbols and repeats
+ */
+TEST_F(Engraving_RenderMidiTests, ScoreMatchesChunks)
+{
+    for (const String& name : { u"all_elements_data/moonlight.mscx",
+                                u"all_elements_data/layout_elements.mscx",
+                                u"timesig_data/timesig-03.mscx" }) {
+        MasterScore* score = ScoreRW::readScore(name);
+        ASSERT_TRUE(score);
+
+        EventMap whole = render(score, 4);
+
+        MidiRenderer renderer(score);
+        MidiRenderer::Context ctx;
+        ctx.metronome = true;
+        ctx.renderHarmony = true;
+
+        EventMap chunked;
+        for (const MidiRenderer::Chunk& chunk : renderer.chunksFromRange(0, score->repeatList().ticks())) {
+            renderer.renderChunk(chunk, &chunked, ctx);
+        }
+
+        EXPECT_FALSE(chunked.empty());
+        compare(chunked, whole);
+
+        delete score;
+    }
+}
@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+
+#include <QImage>
+#include <QPainter>
+
+#include "draw/painter.h"
+#include "draw/internal/qpainterprovider.h"
+
+#include "infrastructure/paint.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/page.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SCORE_PAINT_DATA_DIR(u"all_elements_data/");
+
+namespace {
+class CountingPainterProvider : public draw::QPainterProvider
+{
+public:
+    using draw::QPainterProvider::QPainterProvider;
+
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override
+    {
+        ++symbolRuns;
+        symbols += count;
+        draw::QPainterProvider::drawSymbols(points, ucs4Codes, count);
+    }
+
+    size_t symbolRuns = 0;
+    size_t symbols = 0;
+};
+}
+
+class Engraving_ScorePaintTests : public ::testing::Test
+{
+};
+
+/**
+ * @brief Engraving_ScorePaintTests_Benchmark_PaintPages
+ * @details Paints every page of a dense score into an image with the QPainter provider several times,
+ *          prints the time and how many symbols are passed to the provider per call
+ */
+TEST_F(Engraving_ScorePaintTests, Benchmark_PaintPages)
+{
+    constexpr int PAINT_PASSES = 5;
+    constexpr double IMAGE_SCALE = 0.5;
+
+    // [GIVEN] A laid out dense score
+    MasterScore* score = ScoreRW::readScore(SCORE_PAINT_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+    score->doLayout();
+    ASSERT_FALSE(score->pages().empty());
+
+    // [WHEN] Its pages are painted
+    size_t symbolRuns = 0;
+    size_t symbols = 0;
+    int64_t paintUs = 0;
+
+    for (int pass = 0; pass < PAINT_PASSES; ++pass) {
+        for (Page* page : score->pages()) {
+            RectF pageRect = page->bbox();
+            QImage image(std::lrint(pageRect.width() * IMAGE_SCALE), std::lrint(pageRect.height() * IMAGE_SCALE),
+                         QImage::Format_ARGB32_Premultiplied);
+            image.fill(Qt::white);
+
+            std::vector<EngravingItem*> elements = page->elements();
+
+            QPainter qp(&image);
+            auto provider = std::make_shared<CountingPainterProvider>(&qp);
+
+            auto begin = std::chrono::steady_clock::now();
+            {
+                draw::Painter painter(provider, "scorepaint");
+                painter.setAntialiasing(true);
+                painter.scale(IMAGE_SCALE, IMAGE_SCALE);
+                Paint::paintElements(painter, elements, false);
+                painter.endDraw();
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            paintUs += std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+            symbolRuns += provider->symbolRuns;
+            symbols += provider->symbols;
+        }
+    }
+
+    LOGI() << "pages: " << score->pages().size() << ", paint passes: " << PAINT_PASSES
+           << ", time: " << paintUs / 1000 << " ms"
+           << ", symbols: " << symbols << ", provider calls: " << symbolRuns;
+
+    // [THEN] All symbols are passed to the provider, some of them in runs
+    EXPECT_GT(symbols, 0);
+    EXPECT_LE(symbolRuns, symbols);
+
+    delete score;
+}
@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 
@@ -209,3 +211,39 @@ TEST_F(Engraving_SelectionFilterTests, filterOrnament)
 {
     testFilter(23, SelectionFilterType::ORNAMENT);
 }
+
+TEST_F(Engraving_SelectionFilterTests, selectAllElements)
+{
+    Score* score = ScoreRW::readScore(u"all_elements_data/moonlight.mscx");
+    EXPECT_TRUE(score);
+    score->doLayout();
+
+    score->cmdSelectAll();
+
+    const Selection& sel = score->selection();
+    EXPECT_TRUE(sel.isRange());
+
+    const std::vector<EngravingItem*>& elements = sel.elements();
+    EXPECT_FALSE(elements.empty());
+
+    std::set<EngravingItem*> unique(elements.begin(), elements.end());
+    EXPECT_EQ(unique.size(), elements.size());
+    EXPECT_EQ(sel.uniqueElements().size(), elements.size());
+
+    size_t notes = 0;
+    for (EngravingItem* e : elements) {
+        EXPECT_TRUE(e->selected());
+        if (e->isNote()) {
+            ++notes;
+        }
+    }
+
+    EXPECT_GT(notes, 0);
+    EXPECT_EQ(sel.elementsCount(ElementType::NOTE), notes);
+    EXPECT_EQ(sel.elements(ElementType::NOTE).size(), notes);
+
+    score->deselectAll();
+    EXPECT_EQ(sel.elementsCount(ElementType::NOTE), 0);
+
+    delete score;
+}
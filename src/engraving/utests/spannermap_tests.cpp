@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+
+#include "libmscore/factory.h"
+#include "libmscore/hairpin.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/spannermap.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SPANNERMAP_DATA_SCORE(u"all_elements_data/moonlight.mscx");
+
+// the test spanners are placed after the end of the score, so the spanners of the score are not found
+static constexpr int TICK_OFFSET = 100000000;
+
+class Engraving_SpannerMapTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_score = ScoreRW::readScore(SPANNERMAP_DATA_SCORE);
+        ASSERT_TRUE(m_score);
+    }
+
+    void TearDown() override
+    {
+        for (Spanner* s : m_spanners) {
+            if (m_added.count(s)) {
+                m_score->spannerMap().removeSpanner(s);
+            }
+            delete s;
+        }
+        delete m_score;
+    }
+
+    Spanner* createSpanner(int tick, int ticks)
+    {
+        Hairpin* h = Factory::createHairpin(m_score->dummy()->segment(), false);
+        h->setTick(Fraction::fromTicks(tick));
+        h->setTicks(Fraction::fromTicks(ticks));
+        m_spanners.push_back(h);
+        return h;
+    }
+
+    void add(Spanner* s)
+    {
+        m_score->spannerMap().addSpanner(s);
+        m_added.insert(s);
+    }
+
+    void remove(Spanner* s)
+    {
+        m_score->spannerMap().removeSpanner(s);
+        m_added.erase(s);
+    }
+
+    std::set<Spanner*> expected(int start, int stop, bool overlapping) const
+    {
+        std::set<Spanner*> result;
+        for (Spanner* s : m_added) {
+            int s1 = s->tick().ticks();
+            int s2 = s->tick2().ticks();
+            if (overlapping ? (s2 >= start && s1 <= stop) : (s1 >= start && s2 <= stop)) {
+                result.insert(s);
+            }
+        }
+        return result;
+    }
+
+    static std::set<Spanner*> toSet(const std::vector<interval_tree::Interval<Spanner*> >& intervals)
+    {
+        std::set<Spanner*> result;
+        for (const auto& i : intervals) {
+            result.insert(i.value);
+        }
+        return result;
+    }
+
+    MasterScore* m_score = nullptr;
+    std::vector<Spanner*> m_spanners;
+    std::set<Spanner*> m_added;
+};
+
+TEST_F(Engraving_SpannerMapTests, AddRemoveRetime)
+{
+    const size_t baseSize = m_score->spannerMap().map().size();
+    const int MAX_TICK = 100000;
+    std::mt19937 rng(1);
+
+    for (int i = 0; i < 500; ++i) {
+        add(createSpanner(TICK_OFFSET + rng() % MAX_TICK, rng() % 2000));
+    }
+
+    for (int i = 0; i < 2000; ++i) {
+        Spanner* s = m_spanners.at(rng() % m_spanners.size());
+        switch (rng() % 4) {
+        case 0:
+            if (m_added.count(s)) {
+                remove(s);
+            } else {
+                add(s);
+            }
+            break;
+        case 1:
+            //! NOTE setTick() and setTicks() mark the lookup tree dirty
+            s->setTick(Fraction::fromTicks(TICK_OFFSET + rng() % MAX_TICK));
+            s->setTicks(Fraction::fromTicks(rng() % 2000));
+            break;
+        default: {
+            int start = TICK_OFFSET + rng() % MAX_TICK;
+            int stop = start + rng() % 4000;
+            EXPECT_EQ(toSet(m_score->spannerMap().findOverlapping(start, stop)), expected(start, stop, true));
+            EXPECT_EQ(toSet(m_score->spannerMap().findContained(start, stop)), expected(start, stop, false));
+        } break;
+        }
+    }
+
+    EXPECT_EQ(m_score->spannerMap().map().size(), baseSize + m_added.size());
+}
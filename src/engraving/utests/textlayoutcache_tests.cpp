@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "layout/textlayoutcache.h"
+
+#include "libmscore/chordrest.h"
+#include "libmscore/factory.h"
+#include "libmscore/lyrics.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/segment.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String TEXTLAYOUTCACHE_DATA_DIR(u"all_elements_data/");
+
+class Engraving_TextLayoutCacheTests : public ::testing::Test
+{
+};
+
+static void addLyrics(MasterScore* score, const String& text)
+{
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        ChordRest* cr = toChordRest(s->element(0));
+        if (!cr) {
+            continue;
+        }
+
+        Lyrics* l = Factory::createLyrics(cr);
+        l->setXmlText(text);
+        l->setTrack(0);
+        cr->add(l);
+    }
+}
+
+static void collectLyricsBBox(void* data, EngravingItem* item)
+{
+    if (item->isLyrics()) {
+        static_cast<std::vector<RectF>*>(data)->push_back(item->bbox());
+    }
+}
+
+static std::vector<RectF> lyricsBBoxes(MasterScore* score)
+{
+    std::vector<RectF> bboxes;
+    score->scanElements(&bboxes, collectLyricsBBox, true);
+    return bboxes;
+}
+
+/**
+ * @brief Engraving_TextLayoutCacheTests_HitsMissesInvalidation
+ * @details The same lyrics syllable is laid out once, then taken from the cache,
+ *          the next layout of the score takes all the lines from the cache,
+ *          a style change invalidates the cache and the lines are laid out again with the new spatium
+ */
+TEST_F(Engraving_TextLayoutCacheTests, HitsMissesInvalidation)
+{
+    TextLayoutCache* cache = TextLayoutCache::instance();
+
+    // [GIVEN] A score with the same lyrics syllable on every chord and rest
+    MasterScore* score = ScoreRW::readScore(TEXTLAYOUTCACHE_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+    addLyrics(score, u"lorem");
+    cache->invalidate();
+
+    // [WHEN] The score is laid out
+    TextLayoutCache::Stats before = cache->stats();
+    score->doLayout();
+    TextLayoutCache::Stats first = cache->stats();
+    std::vector<RectF> firstBBoxes = lyricsBBoxes(score);
+    ASSERT_GT(firstBBoxes.size(), 1);
+
+    // [THEN] The syllable is laid out once, the other ones are the cache hits with the same geometry
+    EXPECT_GT(first.misses, before.misses);
+    EXPECT_GE(first.hits - before.hits, firstBBoxes.size() - 1);
+    for (const RectF& bbox : firstBBoxes) {
+        EXPECT_EQ(bbox, firstBBoxes.front());
+    }
+
+    // [WHEN] The score is laid out again
+    score->doLayout();
+    TextLayoutCache::Stats second = cache->stats();
+
+    // [THEN] All the lines are taken from the cache, the geometry is the same
+    EXPECT_EQ(second.misses, first.misses);
+    EXPECT_GT(second.hits, first.hits);
+    EXPECT_EQ(lyricsBBoxes(score), firstBBoxes);
+
+    // [WHEN] The spatium is changed
+    score->style().set(Sid::spatium, score->spatium() * 2);
+    score->styleChanged();
+    TextLayoutCache::Stats changed = cache->stats();
+    score->doLayout();
+    TextLayoutCache::Stats third = cache->stats();
+    std::vector<RectF> thirdBBoxes = lyricsBBoxes(score);
+
+    // [THEN] The cache is invalidated, the lines are laid out again and the lyrics are bigger
+    EXPECT_GT(changed.invalidations, second.invalidations);
+    EXPECT_GT(third.misses, changed.misses);
+    ASSERT_EQ(thirdBBoxes.size(), firstBBoxes.size());
+    EXPECT_GT(thirdBBoxes.front().width(), firstBBoxes.front().width());
+
+    delete score;
+}
@@ -0,0 +1,243 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String UNDO_DATA_SCORE(u"all_elements_data/moonlight.mscx");
+
+class Engraving_UndoTests : public ::testing::Test
+{
+};
+
+static size_t commandCount(const UndoMacro* macro, const char* name)
+{
+    size_t count = 0;
+    for (const UndoCommand* cmd : macro->commands()) {
+        if (!std::strcmp(cmd->name(), name)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+TEST_F(Engraving_UndoTests, CoalesceChangeProperty)
+{
+    MasterScore* score = ScoreRW::readScore(UNDO_DATA_SCORE);
+    ASSERT_TRUE(score);
+
+    Measure* measure = score->firstMeasure();
+    const double stretch = measure->userStretch();
+
+    score->startCmd();
+    measure->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    measure->undoChangeProperty(Pid::USER_STRETCH, 2.0);
+    score->endCmd();
+
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 2.0);
+    EXPECT_EQ(commandCount(score->undoStack()->last(), "ChangeProperty"), 1);
+
+    score->undoRedo(true, nullptr);
+    EXPECT_DOUBLE_EQ(measure->userStretch(), stretch);
+
+    score->undoRedo(false, nullptr);
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 2.0);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoTests, CompactRangeChange)
+{
+    MasterScore* score = ScoreRW::readScore(UNDO_DATA_SCORE);
+    ASSERT_TRUE(score);
+
+    std::vector<double> stretches;
+    score->startCmd();
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        stretches.push_back(m->userStretch());
+        m->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    }
+    score->endCmd();
+
+    ASSERT_GT(stretches.size(), 4);
+    EXPECT_EQ(commandCount(score->undoStack()->last(), "ChangeProperty"), 0);
+    EXPECT_EQ(commandCount(score->undoStack()->last(), "ChangePropertyList"), 1);
+
+    score->undoRedo(true, nullptr);
+    size_t idx = 0;
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        EXPECT_DOUBLE_EQ(m->userStretch(), stretches.at(idx++));
+    }
+
+    score->undoRedo(false, nullptr);
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        EXPECT_DOUBLE_EQ(m->userStretch(), 1.5);
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoTests, ReopenedMacro_FilteredPerElement)
+{
+    MasterScore* score = ScoreRW::readScore(UNDO_DATA_SCORE);
+    ASSERT_TRUE(score);
+
+    // [GIVEN] A range change, compacted to one ChangePropertyList
+    std::vector<double> stretches;
+    score->startCmd();
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        stretches.push_back(m->userStretch());
+        m->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    }
+    score->endCmd();
+
+    UndoStack* undo = score->undoStack();
+    ASSERT_EQ(commandCount(undo->last(), "ChangePropertyList"), 1);
+
+    // [WHEN] The changes of the first measure are filtered out, like on a text edit end
+    Measure* first = score->firstMeasure();
+    undo->reopen();
+    undo->current()->filterChildren(UndoCommand::Filter::ChangePropertyLinked, first);
+    undo->endMacro(false);
+
+    // [THEN] Only the change of that measure is removed
+    EXPECT_EQ(commandCount(undo->last(), "ChangePropertyList"), 1);
+
+    score->undoRedo(true, nullptr);
+    EXPECT_DOUBLE_EQ(first->userStretch(), 1.5);
+
+    size_t idx = 1;
+    for (Measure* m = first->nextMeasure(); m; m = m->nextMeasure()) {
+        EXPECT_DOUBLE_EQ(m->userStretch(), stretches.at(idx++));
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoTests, MemoryUsage_RemovedElements)
+{
+    MasterScore* score = ScoreRW::readScore(UNDO_DATA_SCORE);
+    ASSERT_TRUE(score);
+
+    UndoStack* undo = score->undoStack();
+    undo->setMemoryBudget(0);
+
+    // [GIVEN] A property change of a measure
+    Measure* measure = score->firstMeasure();
+    score->startCmd();
+    measure->undoChangeProperty(Pid::USER_STRETCH, 1.5);
+    score->endCmd();
+    const size_t changeUsage = undo->memoryUsage();
+
+    // [WHEN] The measure is removed
+    score->startCmd();
+    score->undoRemoveMeasures(measure, measure);
+    score->endCmd();
+
+    // [THEN] The removed measure, owned by the undo stack, is counted with its contents
+    const size_t removeUsage = undo->memoryUsage() - changeUsage;
+    EXPECT_GT(removeUsage, 10 * changeUsage);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoTests, MemoryBudget)
+{
+    MasterScore* score = ScoreRW::readScore(UNDO_DATA_SCORE);
+    ASSERT_TRUE(score);
+
+    UndoStack* undo = score->undoStack();
+    undo->setMemoryBudget(0);
+
+    Measure* measure = score->firstMeasure();
+    for (int i = 0; i < 10; ++i) {
+        score->startCmd();
+        measure->undoChangeProperty(Pid::USER_STRETCH, 1.0 + 0.1 * (i + 1));
+        score->endCmd();
+    }
+
+    EXPECT_EQ(undo->stepCount(), 10);
+    EXPECT_EQ(undo->getCurIdx(), 10);
+    EXPECT_GT(undo->memoryUsage(), 0);
+
+    // the budget fits about three steps
+    undo->setMemoryBudget(undo->memoryUsage() * 3 / 10 + 1);
+
+    EXPECT_EQ(undo->stepCount(), 3);
+    EXPECT_EQ(undo->getCurIdx(), 10);
+
+    while (undo->canUndo()) {
+        score->undoRedo(true, nullptr);
+    }
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 1.7);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoTests, MergeAfterStartDropped)
+{
+    MasterScore* score = ScoreRW::readScore(UNDO_DATA_SCORE);
+    ASSERT_TRUE(score);
+
+    UndoStack* undo = score->undoStack();
+    undo->setMemoryBudget(0);
+
+    Measure* measure = score->firstMeasure();
+    auto change = [score, measure](int i) {
+        score->startCmd();
+        measure->undoChangeProperty(Pid::USER_STRETCH, 1.0 + 0.1 * i);
+        score->endCmd();
+    };
+
+    for (int i = 1; i <= 5; ++i) {
+        change(i);
+    }
+
+    // like a text edit, started here
+    size_t startIdx = undo->getCurIdx();
+    for (int i = 6; i <= 10; ++i) {
+        change(i);
+    }
+
+    // the budget fits about three steps, the start macro of the text edit is dropped
+    undo->setMemoryBudget(undo->memoryUsage() * 3 / 10 + 1);
+    ASSERT_EQ(undo->stepCount(), 3);
+
+    // the remaining macros are not merged into one
+    undo->mergeCommands(startIdx);
+    EXPECT_EQ(undo->stepCount(), 3);
+
+    score->undoRedo(true, nullptr);
+    EXPECT_DOUBLE_EQ(measure->userStretch(), 1.9);
+
+    delete score;
+}
@@ -67,6 +67,7 @@ struct DrawPolygon {
 struct DrawText {
     PointF pos;
     String text;
+    bool isSymbol = false; // drawn with drawSymbol, the text is one glyph of a symbol font
 };
 
 struct DrawRectText {
@@ -95,6 +96,8 @@ struct DrawData
         Transform transform;
         bool isAntialiasing = false;
         CompositionMode compositionMode = CompositionMode::SourceOver;
+        bool isClipping = false;
+        RectF clipRect; // without the transform, as QPainter keeps it
     };
 
     struct Data {
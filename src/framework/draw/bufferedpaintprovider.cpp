@@ -107,8 +107,45 @@ const DrawData::State& BufferedPaintProvider::currentState() const
     return currentData().state;
 }
 
-DrawData::Data& BufferedPaintProvider::editableData()
+//! NOTE Returns the last kind of the draws of the data in the paint order, -1 if empty
+static int lastDrawKind(const DrawData::Data& data)
 {
+    if (!data.tiledPixmap.empty()) {
+        return 5;
+    }
+    if (!data.pixmaps.empty()) {
+        return 4;
+    }
+    if (!data.rectTexts.empty()) {
+        return 3;
+    }
+    if (!data.texts.empty()) {
+        return 2;
+    }
+    if (!data.polygons.empty()) {
+        return 1;
+    }
+    if (!data.paths.empty()) {
+        return 0;
+    }
+    return -1;
+}
+
+DrawData::Data& BufferedPaintProvider::editableData(DrawKind kind)
+{
+    DrawData::Data& data = m_currentObjects.top().datas.back();
+
+    //! NOTE To keep the paint order, a draw of an earlier kind
+    //! after the draws of a later kind starts a new data with the same state
+    if (lastDrawKind(data) <= static_cast<int>(kind)) {
+        return data;
+    }
+
+    {
+        DrawData::Data newData;
+        newData.state = data.state;
+        m_currentObjects.top().datas.push_back(std::move(newData));
+    }
     return m_currentObjects.top().datas.back();
 }
 
@@ -202,7 +239,7 @@ void BufferedPaintProvider::drawPath(const PainterPath& path)
     } else if (st.brush.style() == BrushStyle::NoBrush) {
         mode = DrawMode::Stroke;
     }
-    editableData().paths.push_back({ path, st.pen, st.brush, mode });
+    editableData(DrawKind::Path).paths.push_back({ path, st.pen, st.brush, mode });
 }
 
 void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
@@ -211,17 +248,17 @@ void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount,
     for (size_t i = 0; i < pointCount; ++i) {
         pol[i] = PointF(points[i].x(), points[i].y());
     }
-    editableData().polygons.push_back(DrawPolygon { pol, mode });
+    editableData(DrawKind::Polygon).polygons.push_back(DrawPolygon { pol, mode });
 }
 
 void BufferedPaintProvider::drawText(const PointF& point, const String& text)
 {
-    editableData().texts.push_back(DrawText { point, text });
+    editableData(DrawKind::Text).texts.push_back(DrawText { point, text });
 }
 
 void BufferedPaintProvider::drawText(const RectF& rect, int flags, const String& text)
 {
-    editableData().rectTexts.push_back(DrawRectText { rect, flags, text });
+    editableData(DrawKind::RectText).rectTexts.push_back(DrawRectText { rect, flags, text });
 }
 
 void BufferedPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
@@ -232,40 +269,50 @@ void BufferedPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos,
 
 void BufferedPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    drawText(point, String::fromUcs4(&ucs4Code, 1));
+    editableData(DrawKind::Text).texts.push_back(DrawText { point, String::fromUcs4(&ucs4Code, 1), true });
+}
+
+void BufferedPaintProvider::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    std::vector<DrawText>& texts = editableData(DrawKind::Text).texts;
+    texts.reserve(texts.size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        texts.push_back(DrawText { points[i], String::fromUcs4(&ucs4Codes[i], 1), true });
+    }
 }
 
 void BufferedPaintProvider::drawPixmap(const PointF& p, const Pixmap& pm)
 {
-    editableData().pixmaps.push_back(DrawPixmap { p, pm });
+    editableData(DrawKind::Pixmap).pixmaps.push_back(DrawPixmap { p, pm });
 }
 
 void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
-    editableData().tiledPixmap.push_back(DrawTiledPixmap { rect, pm, offset });
+    editableData(DrawKind::TiledPixmap).tiledPixmap.push_back(DrawTiledPixmap { rect, pm, offset });
 }
 
 #ifndef NO_QT_SUPPORT
 void BufferedPaintProvider::drawPixmap(const PointF& p, const QPixmap& pm)
 {
-    editableData().pixmaps.push_back(DrawPixmap { p, Pixmap::fromQPixmap(pm) });
+    editableData(DrawKind::Pixmap).pixmaps.push_back(DrawPixmap { p, Pixmap::fromQPixmap(pm) });
 }
 
 void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
 {
-    editableData().tiledPixmap.push_back(DrawTiledPixmap { rect, Pixmap::fromQPixmap(pm), offset });
+    editableData(DrawKind::TiledPixmap).tiledPixmap.push_back(DrawTiledPixmap { rect, Pixmap::fromQPixmap(pm), offset });
 }
 
 #endif
 
 void BufferedPaintProvider::setClipRect(const RectF& rect)
 {
-    UNUSED(rect);
+    RectF clipRect = currentState().transform.map(rect);
+    editableState().clipRect = clipRect;
 }
 
 void BufferedPaintProvider::setClipping(bool enable)
 {
-    UNUSED(enable);
+    editableState().isClipping = enable;
 }
 
 const DrawData& BufferedPaintProvider::drawData() const
@@ -74,6 +74,7 @@ public:
     void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
 
     void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
 
     void drawPixmap(const PointF& p, const Pixmap& pm) override;
     void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
@@ -93,8 +94,18 @@ public:
 
 private:
 
+    //! NOTE The draws of one data are painted grouped by kind, in this order (see DrawDataPaint)
+    enum class DrawKind {
+        Path = 0,
+        Polygon,
+        Text,
+        RectText,
+        Pixmap,
+        TiledPixmap
+    };
+
     const DrawData::Data& currentData() const;
-    DrawData::Data& editableData();
+    DrawData::Data& editableData(DrawKind kind);
 
     const DrawData::State& currentState() const;
     DrawData::State& editableState();
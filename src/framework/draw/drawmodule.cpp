@@ -26,10 +26,17 @@
 #ifndef DRAW_NO_INTERNAL
 #include "internal/qfontprovider.h"
 #include "internal/qimageprovider.h"
+#include "internal/qpainterprovider.h"
 #endif
 
+#include "log.h"
+
 using namespace mu::draw;
 
+#ifndef DRAW_NO_INTERNAL
+static std::shared_ptr<QFontProvider> s_fontProvider = std::make_shared<QFontProvider>();
+#endif
+
 std::string DrawModule::moduleName() const
 {
     return "draw";
@@ -38,7 +45,19 @@ std::string DrawModule::moduleName() const
 void DrawModule::registerExports()
 {
 #ifndef DRAW_NO_INTERNAL
-    mu::modularity::ioc()->registerExport<draw::IFontProvider>(moduleName(), new QFontProvider());
+    mu::modularity::ioc()->registerExport<draw::IFontProvider>(moduleName(), s_fontProvider);
     mu::modularity::ioc()->registerExport<draw::IImageProvider>(moduleName(), new QImageProvider());
 #endif
 }
+
+void DrawModule::onDeinit()
+{
+#ifndef DRAW_NO_INTERNAL
+    FontMetricsCache::Stats stats = s_fontProvider->metricsCacheStats();
+    LOGI() << "font metrics cache, hits: " << stats.hits << ", misses: " << stats.misses << ", hit rate: " << stats.hitRate();
+
+    PathOutlineCache::Stats pathStats = QPainterProvider::pathOutlineCacheStats();
+    LOGI() << "path outline cache, hits: " << pathStats.hits << ", misses: " << pathStats.misses
+           << ", hit rate: " << pathStats.hitRate();
+#endif
+}
@@ -30,6 +30,7 @@ class DrawModule : public modularity::IModuleSetup
 public:
     std::string moduleName() const override;
     void registerExports() override;
+    void onDeinit() override;
 };
 }
 
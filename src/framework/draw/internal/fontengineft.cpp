@@ -21,6 +21,8 @@
  */
 #include "fontengineft.h"
 
+#include <mutex>
+
 #include <QHash>
 
 #include "io/file.h"
@@ -39,6 +41,9 @@ using namespace mu::draw;
 
 static bool _init_ft()
 {
+    static std::mutex initMutex;
+    std::lock_guard<std::mutex> lock(initMutex);
+
     int error = 0;
     if (!ftlib) {
         error = FT_Init_FreeType(&ftlib);
@@ -60,6 +65,9 @@ struct mu::draw::FTData
     ByteArray fontData;
     FT_Face face = nullptr;
     QHash<char32_t, FTGlyphMetrics> metrics;
+
+    //! NOTE The face and the metrics are shared by all threads (ex. the converter jobs)
+    std::mutex mutex;
 };
 
 FontEngineFT::FontEngineFT()
@@ -101,12 +109,12 @@ bool FontEngineFT::load(const io::path_t& path)
 
 QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
-    if (!gm) {
+    FTGlyphMetrics gm;
+    if (!glyphMetrics(ucs4, gm)) {
         return QRectF();
     }
 
-    const FT_BBox& bb = gm->bb;
+    const FT_BBox& bb = gm.bb;
     //! NOTE Moved form sym.cpp ScoreFont::computeMetrics as is
     double m = 640.0 / dpi_f;
     QRectF bbox;
@@ -116,38 +124,43 @@ QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 
 double FontEngineFT::advance(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
-    if (!gm) {
+    FTGlyphMetrics gm;
+    if (!glyphMetrics(ucs4, gm)) {
         return 0.0;
     }
 
     //! NOTE Moved form sym.cpp ScoreFont::computeMetrics as is
-    return gm->linearHoriAdvance * dpi_f / 655360.0;
+    return gm.linearHoriAdvance * dpi_f / 655360.0;
 }
 
-FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
+bool FontEngineFT::glyphMetrics(char32_t ucs4, FTGlyphMetrics& out) const
 {
-    if (m_data->metrics.contains(ucs4)) {
-        return &m_data->metrics[ucs4];
+    std::lock_guard<std::mutex> lock(m_data->mutex);
+
+    auto it = m_data->metrics.constFind(ucs4);
+    if (it != m_data->metrics.constEnd()) {
+        out = it.value();
+        return true;
     }
 
     FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
     if (index == 0) {
-        return nullptr;
+        return false;
     }
 
     if (FT_Load_Glyph(m_data->face, index, FT_LOAD_DEFAULT) != 0) {
-        return nullptr;
+        return false;
     }
 
     FT_BBox bb;
     if (FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
-        return nullptr;
+        return false;
     }
 
     FTGlyphMetrics& gm = m_data->metrics[ucs4];
     gm.bb = bb;
     gm.linearHoriAdvance = m_data->face->glyph->linearHoriAdvance;
+    out = gm;
 
-    return &gm;
+    return true;
 }
@@ -40,7 +40,7 @@ public:
 
 private:
 
-    FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
+    bool glyphMetrics(char32_t ucs4, FTGlyphMetrics& out) const;
 
     FTData* m_data = nullptr;
 };
@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "fontmetricscache.h"
+
+#include <mutex>
+
+using namespace mu;
+using namespace mu::draw;
+
+//! NOTE Strings are cached per font, the lyrics and texts of a score are a limited set,
+//! but let's not grow without limit for the arbitrary strings
+static constexpr size_t MAX_STRINGS_PER_FONT = 20000;
+
+double FontMetricsCache::Stats::hitRate() const
+{
+    uint64_t total = hits + misses;
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+bool FontMetricsCache::FontKey::operator==(const FontKey& k) const
+{
+    return family == k.family
+           && pointSize == k.pointSize
+           && weight == k.weight
+           && italic == k.italic
+           && noFontMerging == k.noFontMerging
+           && hinting == k.hinting;
+}
+
+size_t FontMetricsCache::FontKeyHash::operator()(const FontKey& k) const
+{
+    size_t h = k.family.hash();
+    h ^= std::hash<double> {}(k.pointSize) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= static_cast<size_t>(k.weight) << 1;
+    h ^= static_cast<size_t>(k.italic) << 9;
+    h ^= static_cast<size_t>(k.noFontMerging) << 10;
+    h ^= static_cast<size_t>(k.hinting) << 11;
+    return h;
+}
+
+FontMetricsCache::FontKey FontMetricsCache::fontKey(const Font& f)
+{
+    FontKey k;
+    k.family = f.family();
+    k.pointSize = f.pointSizeF() > 0 ? f.pointSizeF() : -1.0;
+    //! NOTE The bold flag overrides the weight when the font is resolved (see Font::toQFont)
+    k.weight = f.bold() ? Font::Bold : Font::Normal;
+    k.italic = f.italic();
+    k.noFontMerging = f.noFontMerging();
+    k.hinting = static_cast<int>(f.hinting());
+    return k;
+}
+
+template<typename Key, typename Value>
+Value FontMetricsCache::value(const Font& f, std::unordered_map<Key, Value> FontData::* map, const Key& key,
+                              const std::function<Value()>& compute)
+{
+    if (!m_enabled) {
+        return compute();
+    }
+
+    FontKey fk = fontKey(f);
+
+    {
+        std::shared_lock lock(m_mutex);
+        auto fit = m_fonts.find(fk);
+        if (fit != m_fonts.end()) {
+            const std::unordered_map<Key, Value>& values = fit->second.*map;
+            auto it = values.find(key);
+            if (it != values.end()) {
+                ++m_hits;
+                return it->second;
+            }
+        }
+    }
+
+    ++m_misses;
+    Value val = compute();
+
+    std::unique_lock lock(m_mutex);
+    std::unordered_map<Key, Value>& values = m_fonts[fk].*map;
+    if (values.size() >= MAX_STRINGS_PER_FONT) {
+        values.clear();
+    }
+    values.emplace(key, val);
+
+    return val;
+}
+
+double FontMetricsCache::metric(const Font& f, Metric metric, const ComputeValue& compute)
+{
+    if (!m_enabled) {
+        return compute();
+    }
+
+    FontKey fk = fontKey(f);
+    size_t idx = static_cast<size_t>(metric);
+
+    {
+        std::shared_lock lock(m_mutex);
+        auto fit = m_fonts.find(fk);
+        if (fit != m_fonts.end() && fit->second.hasMetric[idx]) {
+            ++m_hits;
+            return fit->second.metrics[idx];
+        }
+    }
+
+    ++m_misses;
+    double val = compute();
+
+    std::unique_lock lock(m_mutex);
+    FontData& data = m_fonts[fk];
+    data.metrics[idx] = val;
+    data.hasMetric[idx] = true;
+
+    return val;
+}
+
+bool FontMetricsCache::inFont(const Font& f, char32_t ucs4, const ComputeBool& compute)
+{
+    return value(f, &FontData::inFont, ucs4, compute);
+}
+
+bool FontMetricsCache::inFontUcs4(const Font& f, char32_t ucs4, const ComputeBool& compute)
+{
+    return value(f, &FontData::inFontUcs4, ucs4, compute);
+}
+
+double FontMetricsCache::horizontalAdvance(const Font& f, char32_t ucs4, const ComputeValue& compute)
+{
+    return value(f, &FontData::charAdvances, ucs4, compute);
+}
+
+double FontMetricsCache::horizontalAdvance(const Font& f, const String& string, const ComputeValue& compute)
+{
+    return value(f, &FontData::advances, string, compute);
+}
+
+RectF FontMetricsCache::boundingRect(const Font& f, char32_t ucs4, const ComputeRect& compute)
+{
+    return value(f, &FontData::charBoundingRects, ucs4, compute);
+}
+
+RectF FontMetricsCache::boundingRect(const Font& f, const String& string, const ComputeRect& compute)
+{
+    return value(f, &FontData::boundingRects, string, compute);
+}
+
+RectF FontMetricsCache::tightBoundingRect(const Font& f, const String& string, const ComputeRect& compute)
+{
+    return value(f, &FontData::tightBoundingRects, string, compute);
+}
+
+void FontMetricsCache::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+bool FontMetricsCache::isEnabled() const
+{
+    return m_enabled;
+}
+
+FontMetricsCache::Stats FontMetricsCache::stats() const
+{
+    Stats s;
+    s.hits = m_hits;
+    s.misses = m_misses;
+    return s;
+}
+
+void FontMetricsCache::clear()
+{
+    std::unique_lock lock(m_mutex);
+    m_fonts.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
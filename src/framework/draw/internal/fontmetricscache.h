@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_FONTMETRICSCACHE_H
+#define MU_DRAW_FONTMETRICSCACHE_H
+
+#include <atomic>
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "types/string.h"
+#include "types/font.h"
+#include "types/geometry.h"
+
+namespace mu::draw {
+//! NOTE Memoizes text font metrics, which are expensive to get from the font system.
+//! Fonts are compared by the properties that affect metrics only (for example, underline doesn't),
+//! the values are computed by the given functions on a cache miss.
+//! Thread safe.
+class FontMetricsCache
+{
+public:
+    FontMetricsCache() = default;
+
+    enum class Metric {
+        LineSpacing = 0,
+        XHeight,
+        Height,
+        Ascent,
+        Descent,
+
+        Count
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        double hitRate() const;
+    };
+
+    using ComputeValue = std::function<double ()>;
+    using ComputeRect = std::function<RectF()>;
+    using ComputeBool = std::function<bool ()>;
+
+    double metric(const Font& f, Metric metric, const ComputeValue& compute);
+
+    bool inFont(const Font& f, char32_t ucs4, const ComputeBool& compute);
+    bool inFontUcs4(const Font& f, char32_t ucs4, const ComputeBool& compute);
+
+    double horizontalAdvance(const Font& f, char32_t ucs4, const ComputeValue& compute);
+    double horizontalAdvance(const Font& f, const String& string, const ComputeValue& compute);
+
+    RectF boundingRect(const Font& f, char32_t ucs4, const ComputeRect& compute);
+    RectF boundingRect(const Font& f, const String& string, const ComputeRect& compute);
+    RectF tightBoundingRect(const Font& f, const String& string, const ComputeRect& compute);
+
+    //! NOTE When disabled, the values are computed on each call and not counted in the stats
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    Stats stats() const;
+    void clear();
+
+    struct FontKey {
+        String family;
+        double pointSize = -1.0;
+        int weight = 0;
+        bool italic = false;
+        bool noFontMerging = false;
+        int hinting = 0;
+
+        bool operator==(const FontKey& k) const;
+    };
+
+    static FontKey fontKey(const Font& f);
+
+private:
+
+    struct FontKeyHash {
+        size_t operator()(const FontKey& k) const;
+    };
+
+    struct FontData {
+        double metrics[static_cast<size_t>(Metric::Count)] = {};
+        bool hasMetric[static_cast<size_t>(Metric::Count)] = {};
+
+        std::unordered_map<char32_t, bool> inFont;
+        std::unordered_map<char32_t, bool> inFontUcs4;
+        std::unordered_map<char32_t, double> charAdvances;
+        std::unordered_map<char32_t, RectF> charBoundingRects;
+
+        std::unordered_map<String, double> advances;
+        std::unordered_map<String, RectF> boundingRects;
+        std::unordered_map<String, RectF> tightBoundingRects;
+    };
+
+    template<typename Key, typename Value>
+    Value value(const Font& f, std::unordered_map<Key, Value> FontData::* map, const Key& key, const std::function<Value()>& compute);
+
+    std::unordered_map<FontKey, FontData, FontKeyHash> m_fonts;
+    mutable std::shared_mutex m_mutex;
+
+    std::atomic<bool> m_enabled = true;
+    std::atomic<uint64_t> m_hits = 0;
+    std::atomic<uint64_t> m_misses = 0;
+};
+}
+
+#endif // MU_DRAW_FONTMETRICSCACHE_H
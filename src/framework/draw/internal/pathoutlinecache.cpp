@@ -0,0 +1,208 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pathoutlinecache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QPainterPathStroker>
+
+using namespace mu;
+using namespace mu::draw;
+
+//! NOTE A piano score has a few thousands of slurs and ties
+static constexpr size_t MAX_ENTRIES = 8192;
+
+//! NOTE The farthest a curve may go from its flattened segments, in device pixels
+static constexpr double DEVICE_TOLERANCE = 0.25;
+
+static size_t hashCombine(size_t h, size_t v)
+{
+    return h ^ (v + 0x9e3779b9 + (h << 6) + (h >> 2));
+}
+
+double PathOutlineCache::Stats::hitRate() const
+{
+    uint64_t total = hits + misses;
+    return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+bool PathOutlineCache::Key::operator==(const Key& k) const
+{
+    return toleranceLevel == k.toleranceLevel
+           && hasStroke == k.hasStroke
+           && penStyle == k.penStyle
+           && capStyle == k.capStyle
+           && joinStyle == k.joinStyle
+           && penWidth == k.penWidth
+           && dashPattern == k.dashPattern
+           && path.fillRule() == k.path.fillRule()
+           && path == k.path;
+}
+
+size_t PathOutlineCache::KeyHash::operator()(const Key& k) const
+{
+    std::hash<double> hashDouble;
+
+    size_t h = std::hash<int> {}(k.toleranceLevel);
+    h = hashCombine(h, static_cast<size_t>(k.hasStroke));
+    h = hashCombine(h, static_cast<size_t>(k.penStyle));
+    h = hashCombine(h, static_cast<size_t>(k.capStyle));
+    h = hashCombine(h, static_cast<size_t>(k.joinStyle));
+    h = hashCombine(h, hashDouble(k.penWidth));
+    for (double d : k.dashPattern) {
+        h = hashCombine(h, hashDouble(d));
+    }
+
+    for (size_t i = 0; i < k.path.elementCount(); ++i) {
+        PainterPath::Element e = k.path.elementAt(i);
+        h = hashCombine(h, hashDouble(e.x));
+        h = hashCombine(h, hashDouble(e.y));
+        h = hashCombine(h, static_cast<size_t>(e.type));
+    }
+
+    return h;
+}
+
+bool PathOutlineCache::isCacheable(const PainterPath& path, const Pen& pen)
+{
+    //! NOTE Zero width pens are cosmetic, they don't scale with the device
+    if (pen.style() != PenStyle::NoPen && pen.widthF() <= 0.0) {
+        return false;
+    }
+
+    return path.hasCurves();
+}
+
+PathOutlineCache::Outline PathOutlineCache::outline(const PainterPath& path, const Pen& pen, double deviceScale)
+{
+    Key key;
+    key.path = path;
+    key.penStyle = pen.style();
+    key.toleranceLevel = static_cast<int>(std::ceil(std::log2(std::max(deviceScale, 1e-6))));
+    key.toleranceLevel = std::clamp(key.toleranceLevel, -16, 16);
+
+    if (pen.style() != PenStyle::NoPen) {
+        key.penWidth = pen.widthF();
+        key.capStyle = pen.capStyle();
+        key.joinStyle = pen.joinStyle();
+        key.dashPattern = pen.dashPattern();
+        key.hasStroke = pen.widthF() * deviceScale > 1.0;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            it->second.lastUse = ++m_useCounter;
+            ++m_hits;
+            return it->second.outline;
+        }
+    }
+
+    ++m_misses;
+
+    //! NOTE Made out of the lock, another thread may make the same outline meanwhile, that's fine
+    Outline outline = makeOutline(key);
+
+    std::lock_guard lock(m_mutex);
+    if (m_entries.size() >= MAX_ENTRIES) {
+        evict();
+    }
+
+    Entry& entry = m_entries[std::move(key)];
+    entry.outline = outline;
+    entry.lastUse = ++m_useCounter;
+
+    return outline;
+}
+
+PathOutlineCache::Outline PathOutlineCache::makeOutline(const Key& key)
+{
+    //! NOTE The level is the power of two not less than the scale, so the device error is not more than the tolerance
+    double tolerance = DEVICE_TOLERANCE / std::pow(2.0, key.toleranceLevel);
+
+    Outline outline;
+    outline.fill.setFillRule(static_cast<Qt::FillRule>(key.path.fillRule()));
+
+    for (const PolygonF& polygon : key.path.toSubpathPolygons(tolerance)) {
+        QPolygonF qpolygon;
+        qpolygon.reserve(static_cast<int>(polygon.size()));
+        for (const PointF& p : polygon) {
+            qpolygon << QPointF(p.x(), p.y());
+        }
+        outline.fill.addPolygon(qpolygon);
+    }
+
+    if (key.hasStroke) {
+        QPainterPathStroker stroker;
+        stroker.setWidth(key.penWidth);
+        stroker.setCapStyle(static_cast<Qt::PenCapStyle>(key.capStyle));
+        stroker.setJoinStyle(static_cast<Qt::PenJoinStyle>(key.joinStyle));
+        if (!key.dashPattern.empty()) {
+            stroker.setDashPattern(QVector<qreal>(key.dashPattern.cbegin(), key.dashPattern.cend()));
+        }
+
+        outline.stroke = stroker.createStroke(outline.fill);
+    }
+
+    return outline;
+}
+
+void PathOutlineCache::evict()
+{
+    //! NOTE Drops the least recently used half at once, not to sort on each insert
+    std::vector<uint64_t> uses;
+    uses.reserve(m_entries.size());
+    for (const auto& p : m_entries) {
+        uses.push_back(p.second.lastUse);
+    }
+
+    auto median = uses.begin() + uses.size() / 2;
+    std::nth_element(uses.begin(), median, uses.end());
+    uint64_t threshold = *median;
+
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.lastUse < threshold) {
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+PathOutlineCache::Stats PathOutlineCache::stats() const
+{
+    Stats s;
+    s.hits = m_hits;
+    s.misses = m_misses;
+    return s;
+}
+
+void PathOutlineCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_entries.clear();
+    m_useCounter = 0;
+    m_hits = 0;
+    m_misses = 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_PATHOUTLINECACHE_H
+#define MU_DRAW_PATHOUTLINECACHE_H
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QPainterPath>
+
+#include "types/painterpath.h"
+#include "types/pen.h"
+
+namespace mu::draw {
+//! NOTE Memoizes the flattened geometry of the curved paths (slurs, ties and so on),
+//! so that the curves are not flattened and the pen is not stroked on each paint.
+//! The paths are compared by their elements, so a relayout that moves the control points
+//! gives a new entry and the old one goes away with the least recently used.
+//! The flattening tolerance follows the device scale in power of two steps.
+//! Thread safe, the pages are rendered on several threads.
+class PathOutlineCache
+{
+public:
+    PathOutlineCache() = default;
+
+    struct Outline {
+        QPainterPath fill;      // the path with the curves flattened
+        QPainterPath stroke;    // the pen outline to fill with the pen color, empty if there is no pen
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        double hitRate() const;
+    };
+
+    static bool isCacheable(const PainterPath& path, const Pen& pen);
+
+    //! NOTE Thin pens (a pixel wide or less) are drawn by the engine better than their outline,
+    //! so for them the stroke is empty and the fill path must be stroked with the pen
+    Outline outline(const PainterPath& path, const Pen& pen, double deviceScale);
+
+    Stats stats() const;
+    void clear();
+
+private:
+
+    struct Key {
+        PainterPath path;
+        double penWidth = 0.0;
+        PenStyle penStyle = PenStyle::NoPen;
+        PenCapStyle capStyle = PenCapStyle::SquareCap;
+        PenJoinStyle joinStyle = PenJoinStyle::BevelJoin;
+        std::vector<double> dashPattern;
+        int toleranceLevel = 0;
+        bool hasStroke = false;
+
+        bool operator==(const Key& k) const;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const;
+    };
+
+    struct Entry {
+        Outline outline;
+        uint64_t lastUse = 0;
+    };
+
+    static Outline makeOutline(const Key& key);
+    void evict();
+
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+    uint64_t m_useCounter = 0;
+    mutable std::mutex m_mutex;
+
+    std::atomic<uint64_t> m_hits = 0;
+    std::atomic<uint64_t> m_misses = 0;
+};
+}
+
+#endif // MU_DRAW_PATHOUTLINECACHE_H
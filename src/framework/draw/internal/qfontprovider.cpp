@@ -55,79 +55,104 @@ static FontPaintDevice device;
 int QFontProvider::addSymbolFont(const String& family, const io::path_t& path)
 {
     m_symbolsFonts[family] = path;
+    m_metricsCache.clear();
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
 int QFontProvider::addTextFont(const io::path_t& path)
 {
+    m_metricsCache.clear();
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
 void QFontProvider::insertSubstitution(const String& familyName, const String& substituteName)
 {
     QFont::insertSubstitution(familyName, substituteName);
+    m_metricsCache.clear();
 }
 
 double QFontProvider::lineSpacing(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).lineSpacing();
+    return m_metricsCache.metric(f, FontMetricsCache::Metric::LineSpacing, [&f]() {
+        return QFontMetricsF(f.toQFont(), &device).lineSpacing();
+    });
 }
 
 double QFontProvider::xHeight(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).xHeight();
+    return m_metricsCache.metric(f, FontMetricsCache::Metric::XHeight, [&f]() {
+        return QFontMetricsF(f.toQFont(), &device).xHeight();
+    });
 }
 
 double QFontProvider::height(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).height();
+    return m_metricsCache.metric(f, FontMetricsCache::Metric::Height, [&f]() {
+        return QFontMetricsF(f.toQFont(), &device).height();
+    });
 }
 
 double QFontProvider::ascent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).ascent();
+    return m_metricsCache.metric(f, FontMetricsCache::Metric::Ascent, [&f]() {
+        return QFontMetricsF(f.toQFont(), &device).ascent();
+    });
 }
 
 double QFontProvider::descent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).descent();
+    return m_metricsCache.metric(f, FontMetricsCache::Metric::Descent, [&f]() {
+        return QFontMetricsF(f.toQFont(), &device).descent();
+    });
 }
 
 bool QFontProvider::inFont(const Font& f, Char ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    return m_metricsCache.inFont(f, ch.unicode(), [&f, ch]() {
+        return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    });
 }
 
 bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 {
-    if (!QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4)) {
-        return false;
-    }
+    return m_metricsCache.inFontUcs4(f, ucs4, [this, &f, ucs4]() {
+        if (!QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4)) {
+            return false;
+        }
 
-    //! @NOTE some symbols in fonts dont have glyph. For example U+ee80
-    //! exists in Bravura.otf but doesn't have glyph
-    //! so QFontMetricsF returns true in that case
-    return symBBox(f, ucs4, 1.).isValid();
+        //! @NOTE some symbols in fonts dont have glyph. For example U+ee80
+        //! exists in Bravura.otf but doesn't have glyph
+        //! so QFontMetricsF returns true in that case
+        return symBBox(f, ucs4, 1.).isValid();
+    });
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const String& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    return m_metricsCache.horizontalAdvance(f, string, [&f, &string]() {
+        return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    });
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    return m_metricsCache.horizontalAdvance(f, ch.unicode(), [&f, &ch]() {
+        return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    return m_metricsCache.boundingRect(f, string, [&f, &string]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const Char& ch) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    return m_metricsCache.boundingRect(f, ch.unicode(), [&f, &ch]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, const String& string) const
@@ -137,7 +162,9 @@ RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, cons
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    return m_metricsCache.tightBoundingRect(f, string, [&f, &string]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    });
 }
 
 // Score symbols
@@ -197,6 +224,8 @@ double QFontProvider::symAdvance(const Font& f, char32_t ucs4, double dpi_f) con
 
 FontEngineFT* QFontProvider::symEngine(const Font& f) const
 {
+    std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+
     QString path = m_symbolsFonts.value(f.family()).toQString();
     if (path.isEmpty()) {
         return nullptr;
@@ -213,3 +242,18 @@ FontEngineFT* QFontProvider::symEngine(const Font& f) const
     }
     return engine;
 }
+
+FontMetricsCache::Stats QFontProvider::metricsCacheStats() const
+{
+    return m_metricsCache.stats();
+}
+
+void QFontProvider::setMetricsCacheEnabled(bool enabled)
+{
+    m_metricsCache.setEnabled(enabled);
+}
+
+void QFontProvider::clearMetricsCache()
+{
+    m_metricsCache.clear();
+}
@@ -22,8 +22,12 @@
 #ifndef MU_DRAW_QFONTPROVIDER_H
 #define MU_DRAW_QFONTPROVIDER_H
 
+#include <mutex>
+
 #include <QHash>
+
 #include "ifontprovider.h"
+#include "fontmetricscache.h"
 
 namespace mu::draw {
 class FontEngineFT;
@@ -58,12 +62,19 @@ public:
     RectF symBBox(const Font& f, char32_t ucs4, double DPI_F) const override;
     double symAdvance(const Font& f, char32_t ucs4, double DPI_F) const override;
 
+    FontMetricsCache::Stats metricsCacheStats() const;
+    void setMetricsCacheEnabled(bool enabled);
+    void clearMetricsCache();
+
 private:
 
     FontEngineFT* symEngine(const Font& f) const;
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+    mutable std::mutex m_symEnginesMutex;
+
+    mutable FontMetricsCache m_metricsCache;
 };
 }
 
@@ -21,7 +21,10 @@
  */
 #include "qpainterprovider.h"
 
+#include <cmath>
+
 #include <QPainter>
+#include <QPaintEngine>
 #include <QRawFont>
 #include <QTextLayout>
 #include <QTextLine>
@@ -29,8 +32,12 @@
 #include <QPixmapCache>
 #include <QStaticText>
 #include <QPainterPath>
+#include <QCoreApplication>
+#include <QImage>
+#include <QThread>
 
 #include "draw/utils/drawlogger.h"
+#include "pathoutlinecache.h"
 #include "types/transform.h"
 #include "types/painterpath.h"
 
@@ -38,6 +45,8 @@
 
 using namespace mu::draw;
 
+static PathOutlineCache s_pathOutlineCache;
+
 QPainterProvider::QPainterProvider(QPainter* painter, bool ownsPainter)
     : m_painter(painter), m_ownsPainter(ownsPainter), m_drawObjectsLogger(new DrawObjectsLogger())
 {
@@ -173,6 +182,7 @@ void QPainterProvider::restore()
     m_font = Font::fromQFont(m_painter->font());
     m_pen = Pen::fromQPen(m_painter->pen());
     m_brush = Brush::fromQBrush(m_painter->brush());
+    m_transform = Transform::fromQTransform(m_painter->worldTransform());
 }
 
 void QPainterProvider::setTransform(const Transform& transform)
@@ -190,7 +200,29 @@ const Transform& QPainterProvider::transform() const
 
 void QPainterProvider::drawPath(const PainterPath& path)
 {
-    m_painter->drawPath(PainterPath::toQPainterPath(path));
+    //! NOTE Vector engines (SVG, PDF) must keep the curves,
+    //! so only raster targets draw the cached flattened outlines
+    if (!isRasterTarget() || !PathOutlineCache::isCacheable(path, m_pen)) {
+        m_painter->drawPath(PainterPath::toQPainterPath(path));
+        return;
+    }
+
+    double deviceScale = std::sqrt(std::fabs(m_painter->deviceTransform().determinant()));
+    PathOutlineCache::Outline outline = s_pathOutlineCache.outline(path, m_pen, deviceScale);
+
+    if (m_brush.style() != BrushStyle::NoBrush) {
+        m_painter->fillPath(outline.fill, m_painter->brush());
+    }
+
+    if (m_pen.style() == PenStyle::NoPen) {
+        return;
+    }
+
+    if (outline.stroke.isEmpty()) {
+        m_painter->strokePath(outline.fill, m_painter->pen());
+    } else {
+        m_painter->fillPath(outline.stroke, m_painter->pen().brush());
+    }
 }
 
 void QPainterProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
@@ -286,9 +318,21 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
     m_painter->restore();
 }
 
+bool QPainterProvider::isRasterTarget() const
+{
+    const QPaintEngine* engine = m_painter->paintEngine();
+    return engine && (engine->type() == QPaintEngine::Raster || engine->type() == QPaintEngine::OpenGL2);
+}
+
+PathOutlineCache::Stats QPainterProvider::pathOutlineCacheStats()
+{
+    return s_pathOutlineCache.stats();
+}
+
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    static QHash<char32_t, QString> cache;
+    //! NOTE Page tiles are rendered on background threads too
+    thread_local QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
     }
@@ -296,8 +340,67 @@ void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
     m_painter->drawText(QPointF(point.x(), point.y()), cache[ucs4Code]);
 }
 
+void QPainterProvider::drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    //! NOTE Vector engines (SVG, PDF) must keep the symbols as text,
+    //! so only raster targets get a native glyph run
+    if (!isRasterTarget()) {
+        for (size_t i = 0; i < count; ++i) {
+            drawSymbol(points[i], ucs4Codes[i]);
+        }
+        return;
+    }
+
+    QFont font(m_painter->font(), m_painter->device());
+    if (!m_rawFont.isValid() || font != m_rawFontSource) {
+        m_rawFontSource = font;
+        m_rawFont = QRawFont::fromFont(font);
+    }
+
+    QString text = QString::fromUcs4(ucs4Codes, static_cast<int>(count));
+    QVector<quint32> glyphs = m_rawFont.glyphIndexesForString(text);
+
+    //! NOTE Surrogates or missing glyphs, fall back to text drawing
+    if (!m_rawFont.isValid() || glyphs.size() != static_cast<int>(count) || glyphs.contains(0)) {
+        for (size_t i = 0; i < count; ++i) {
+            drawSymbol(points[i], ucs4Codes[i]);
+        }
+        return;
+    }
+
+    QVector<QPointF> positions;
+    positions.reserve(static_cast<int>(count));
+    for (size_t i = 0; i < count; ++i) {
+        positions.push_back(points[i].toQPointF());
+    }
+
+    QGlyphRun run;
+    run.setRawFont(m_rawFont);
+    run.setGlyphIndexes(glyphs);
+    run.setPositions(positions);
+
+    m_painter->drawGlyphRun(QPointF(), run);
+}
+
+static bool isGuiThread()
+{
+    return QCoreApplication::instance() && QThread::currentThread() == QCoreApplication::instance()->thread();
+}
+
 void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 {
+    //! NOTE QPixmap can only be used on the gui thread
+    if (!isGuiThread()) {
+        QImage image;
+        image.loadFromData(pm.data().toQByteArrayNoCopy());
+        m_painter->drawImage(QPointF(point.x(), point.y()), image);
+        return;
+    }
+
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -310,6 +413,15 @@ void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 
 void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
+    if (!isGuiThread()) {
+        QImage image;
+        image.loadFromData(pm.data().toQByteArrayNoCopy());
+        QBrush brush(image);
+        brush.setTransform(QTransform::fromTranslate(rect.x() - offset.x(), rect.y() - offset.y()));
+        m_painter->fillRect(rect.toQRectF(), brush);
+        return;
+    }
+
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -22,7 +22,11 @@
 #ifndef MU_DRAW_QPAINTERPROVIDER_H
 #define MU_DRAW_QPAINTERPROVIDER_H
 
+#include <QFont>
+#include <QRawFont>
+
 #include "ipaintprovider.h"
+#include "pathoutlinecache.h"
 
 class QPainter;
 class QImage;
@@ -40,6 +44,8 @@ public:
 
     QPainter* qpainter() const;
 
+    static PathOutlineCache::Stats pathOutlineCacheStats();
+
     void beginTarget(const std::string& name) override;
     void beforeEndTargetHook(Painter* painter) override;
     bool endTarget(bool endDraw = false) override;
@@ -76,6 +82,7 @@ public:
     void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
 
     void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override;
 
     void drawPixmap(const PointF& point, const Pixmap& pm) override;
     void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
@@ -90,6 +97,8 @@ protected:
     QPainter* m_painter = nullptr;
 
 private:
+    bool isRasterTarget() const;
+
     bool m_ownsPainter = false;
     DrawObjectsLogger* m_drawObjectsLogger = nullptr;
     Font m_font;
@@ -97,6 +106,9 @@ private:
     Brush m_brush;
 
     Transform m_transform;
+
+    QFont m_rawFontSource;
+    QRawFont m_rawFont;
 };
 }
 
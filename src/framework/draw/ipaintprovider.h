@@ -76,6 +76,8 @@ public:
     virtual void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) = 0; // see Painter::drawTextWorkaround .h file
 
     virtual void drawSymbol(const PointF& point, char32_t ucs4Code) = 0;
+    //! NOTE Draws a run of symbols with the current font, pen and transform
+    virtual void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) = 0;
 
     virtual void drawPixmap(const PointF& point, const Pixmap& pm) = 0;
     virtual void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) = 0;
@@ -65,17 +65,18 @@ Painter::~Painter()
 
 void Painter::init()
 {
+    //! NOTE The target is begun first, buffered providers have no state before it
+    m_provider->beginTarget(m_name);
+    if (extended) {
+        extended->beginTarget(m_name);
+    }
+
     State st;
     st.worldTransform = m_provider->transform();
     st.isWxF = true;
 
     m_states = std::stack<State>();
     m_states.push(std::move(st));
-
-    m_provider->beginTarget(m_name);
-    if (extended) {
-        extended->beginTarget(m_name);
-    }
 }
 
 IPaintProviderPtr Painter::provider() const
@@ -85,6 +86,8 @@ IPaintProviderPtr Painter::provider() const
 
 void Painter::setProvider(const IPaintProviderPtr& p, bool reinit)
 {
+    flushSymbols();
+
     m_provider = p;
     if (reinit) {
         init();
@@ -98,6 +101,8 @@ bool Painter::endDraw()
 
 bool Painter::endTarget(bool endDraw)
 {
+    flushSymbols();
+
     m_provider->beforeEndTargetHook(this);
     if (extended) {
         extended->beforeEndTargetHook(this);
@@ -117,6 +122,8 @@ bool Painter::isActive() const
 
 void Painter::beginObject(const std::string& name, const PointF& pagePos)
 {
+    flushSymbols();
+
     m_provider->beginObject(name, pagePos);
     if (extended) {
         extended->beginObject(name, pagePos);
@@ -125,6 +132,8 @@ void Painter::beginObject(const std::string& name, const PointF& pagePos)
 
 void Painter::endObject()
 {
+    flushSymbols();
+
     m_provider->endObject();
     if (extended) {
         extended->endObject();
@@ -133,6 +142,8 @@ void Painter::endObject()
 
 void Painter::setAntialiasing(bool arg)
 {
+    flushSymbols();
+
     m_provider->setAntialiasing(arg);
     if (extended) {
         extended->setAntialiasing(arg);
@@ -141,6 +152,8 @@ void Painter::setAntialiasing(bool arg)
 
 void Painter::setCompositionMode(CompositionMode mode)
 {
+    flushSymbols();
+
     m_provider->setCompositionMode(mode);
     if (extended) {
         extended->setCompositionMode(mode);
@@ -149,6 +162,8 @@ void Painter::setCompositionMode(CompositionMode mode)
 
 void Painter::setFont(const Font& font)
 {
+    flushSymbols();
+
     m_provider->setFont(font);
     if (extended) {
         extended->setFont(font);
@@ -162,6 +177,8 @@ const Font& Painter::font() const
 
 void Painter::setPen(const Pen& pen)
 {
+    flushSymbols();
+
     m_provider->setPen(pen);
     if (extended) {
         extended->setPen(pen);
@@ -180,6 +197,8 @@ const Pen& Painter::pen() const
 
 void Painter::setBrush(const Brush& brush)
 {
+    flushSymbols();
+
     m_provider->setBrush(brush);
     if (extended) {
         extended->setBrush(brush);
@@ -193,6 +212,8 @@ const Brush& Painter::brush() const
 
 void Painter::save()
 {
+    flushSymbols();
+
     State newSt = m_states.top();
     m_states.push(newSt);
 
@@ -204,6 +225,8 @@ void Painter::save()
 
 void Painter::restore()
 {
+    flushSymbols();
+
     if (m_states.size() > 0) {
         m_states.pop();
     }
@@ -216,6 +239,8 @@ void Painter::restore()
 
 void Painter::setWorldTransform(const Transform& matrix, bool combine)
 {
+    flushSymbols();
+
     State& st = editableState();
     if (combine) {
         st.worldTransform = matrix * st.worldTransform;                        // combines
@@ -233,6 +258,8 @@ const Transform& Painter::worldTransform() const
 
 void Painter::scale(double sx, double sy)
 {
+    flushSymbols();
+
     State& st = editableState();
     st.worldTransform.scale(sx, sy);
     st.isWxF = true;
@@ -241,6 +268,8 @@ void Painter::scale(double sx, double sy)
 
 void Painter::rotate(double angle)
 {
+    flushSymbols();
+
     State& st = editableState();
     st.worldTransform.rotate(angle);
     st.isWxF = true;
@@ -249,6 +278,8 @@ void Painter::rotate(double angle)
 
 void Painter::translate(double dx, double dy)
 {
+    flushSymbols();
+
     State& st = editableState();
     st.worldTransform.translate(dx, dy);
     st.isWxF = true;
@@ -262,6 +293,8 @@ RectF Painter::window() const
 
 void Painter::setWindow(const RectF& window)
 {
+    flushSymbols();
+
     State& st = editableState();
     st.window = window;
     st.isVxF = true;
@@ -275,6 +308,8 @@ RectF Painter::viewport() const
 
 void Painter::setViewport(const RectF& viewport)
 {
+    flushSymbols();
+
     State& st = editableState();
     st.viewport = viewport;
     st.isVxF = true;
@@ -311,6 +346,8 @@ void Painter::strokePath(const PainterPath& path, const Pen& pen)
 
 void Painter::drawPath(const PainterPath& path)
 {
+    flushSymbols();
+
     m_provider->drawPath(path);
     if (extended) {
         extended->drawPath(path);
@@ -349,6 +386,8 @@ void Painter::drawRects(const RectF* rects, size_t rectCount)
 
 void Painter::drawEllipse(const RectF& rect)
 {
+    flushSymbols();
+
     PainterPath path;
     path.addEllipse(rect);
     m_provider->drawPath(path);
@@ -359,6 +398,8 @@ void Painter::drawEllipse(const RectF& rect)
 
 void Painter::drawPolyline(const PointF* points, size_t pointCount)
 {
+    flushSymbols();
+
     m_provider->drawPolygon(points, pointCount, PolygonMode::Polyline);
     if (extended) {
         extended->drawPolygon(points, pointCount, PolygonMode::Polyline);
@@ -367,6 +408,8 @@ void Painter::drawPolyline(const PointF* points, size_t pointCount)
 
 void Painter::drawPolygon(const PointF* points, size_t pointCount, FillRule fillRule)
 {
+    flushSymbols();
+
     PolygonMode mode = (fillRule == FillRule::OddEvenFill) ? PolygonMode::OddEven : PolygonMode::Winding;
     m_provider->drawPolygon(points, pointCount, mode);
     if (extended) {
@@ -376,6 +419,8 @@ void Painter::drawPolygon(const PointF* points, size_t pointCount, FillRule fill
 
 void Painter::drawConvexPolygon(const PointF* points, size_t pointCount)
 {
+    flushSymbols();
+
     m_provider->drawPolygon(points, pointCount, PolygonMode::Convex);
     if (extended) {
         extended->drawPolygon(points, pointCount, PolygonMode::Convex);
@@ -408,6 +453,8 @@ void Painter::drawRoundedRect(const RectF& rect, double xRadius, double yRadius)
 
 void Painter::drawText(const PointF& point, const String& text)
 {
+    flushSymbols();
+
     m_provider->drawText(point, text);
     if (extended) {
         extended->drawText(point, text);
@@ -416,6 +463,8 @@ void Painter::drawText(const PointF& point, const String& text)
 
 void Painter::drawText(const RectF& rect, int flags, const String& text)
 {
+    flushSymbols();
+
     m_provider->drawText(rect, flags, text);
     if (extended) {
         extended->drawText(rect, flags, text);
@@ -424,20 +473,37 @@ void Painter::drawText(const RectF& rect, int flags, const String& text)
 
 void Painter::drawTextWorkaround(Font& f, const PointF pos, const String& text)
 {
+    flushSymbols();
+
     m_provider->drawTextWorkaround(f, pos, text);
     if (extended) {
         extended->drawTextWorkaround(f, pos, text);
     }
 }
 
+//! NOTE Every state change flushes the run, so the symbols of a run share the current state of the provider
 void Painter::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    m_provider->drawSymbol(point, ucs4Code);
+    m_symbolRun.points.push_back(point);
+    m_symbolRun.codes.push_back(ucs4Code);
+
     if (extended) {
         extended->drawSymbol(point, ucs4Code);
     }
 }
 
+void Painter::flushSymbols()
+{
+    if (m_symbolRun.empty()) {
+        return;
+    }
+
+    m_provider->drawSymbols(m_symbolRun.points.data(), m_symbolRun.codes.data(), m_symbolRun.codes.size());
+
+    m_symbolRun.points.clear();
+    m_symbolRun.codes.clear();
+}
+
 void Painter::fillRect(const RectF& rect, const Brush& brush)
 {
     Pen oldPen = this->pen();
@@ -453,6 +519,8 @@ void Painter::fillRect(const RectF& rect, const Brush& brush)
 
 void Painter::drawPixmap(const PointF& point, const Pixmap& pm)
 {
+    flushSymbols();
+
     m_provider->drawPixmap(point, pm);
     if (extended) {
         extended->drawPixmap(point, pm);
@@ -461,6 +529,8 @@ void Painter::drawPixmap(const PointF& point, const Pixmap& pm)
 
 void Painter::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
+    flushSymbols();
+
     m_provider->drawTiledPixmap(rect, pm, offset);
     if (extended) {
         extended->drawTiledPixmap(rect, pm, offset);
@@ -470,6 +540,8 @@ void Painter::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF&
 #ifndef NO_QT_SUPPORT
 void Painter::drawPixmap(const PointF& point, const QPixmap& pm)
 {
+    flushSymbols();
+
     m_provider->drawPixmap(point, pm);
     if (extended) {
         extended->drawPixmap(point, pm);
@@ -478,6 +550,8 @@ void Painter::drawPixmap(const PointF& point, const QPixmap& pm)
 
 void Painter::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
 {
+    flushSymbols();
+
     m_provider->drawTiledPixmap(rect, pm, offset);
     if (extended) {
         extended->drawTiledPixmap(rect, pm, offset);
@@ -520,10 +594,14 @@ void Painter::updateMatrix()
 
 void Painter::setClipRect(const RectF& rect)
 {
+    flushSymbols();
+
     m_provider->setClipRect(rect);
 }
 
 void Painter::setClipping(bool enable)
 {
+    flushSymbols();
+
     m_provider->setClipping(enable);
 }
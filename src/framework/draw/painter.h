@@ -24,6 +24,7 @@
 
 #include <list>
 #include <stack>
+#include <vector>
 
 #include "config.h"
 #include "ipaintprovider.h"
@@ -156,7 +157,10 @@ public:
     //! (moved from TextBase::drawTextWorkaround)
     void drawTextWorkaround(Font& f, const PointF pos, const String& text);
 
+    //! NOTE Consecutive symbols drawn without a state change in between are collected
+    //! into one run and passed to the provider at once, any state change or other drawing flushes the run
     void drawSymbol(const PointF& point, char32_t ucs4Code);
+    void flushSymbols();
 
     void fillRect(const RectF& rect, const Brush& brush);
 
@@ -195,9 +199,17 @@ private:
 
     bool endTarget(bool endDraw);
 
+    struct SymbolRun {
+        std::vector<PointF> points;
+        std::vector<char32_t> codes;
+
+        bool empty() const { return codes.empty(); }
+    };
+
     IPaintProviderPtr m_provider;
     std::string m_name;
     std::stack<State> m_states;
+    SymbolRun m_symbolRun;
 };
 
 inline void Painter::setPen(const Color& color)
@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawcomp.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_DrawCompTests : public ::testing::Test
+{
+public:
+    DrawData record(double lineLength, const String& text) const
+    {
+        auto provider = std::make_shared<BufferedPaintProvider>();
+        Painter painter(provider, "record");
+
+        painter.setPen(Pen(Color::black, 2.0));
+        painter.drawLine(PointF(0.0, 0.0), PointF(lineLength, 0.0));
+        painter.drawText(PointF(2.0, 2.0), text);
+
+        painter.endDraw();
+        return provider->drawData();
+    }
+};
+
+TEST_F(Draw_DrawCompTests, Hash_SameContent)
+{
+    //! [GIVEN] The same content recorded twice
+    DrawData data1 = record(5.0, u"text");
+    DrawData data2 = record(5.0, u"text");
+
+    //! [THEN] The hashes are equal
+    EXPECT_EQ(DrawComp::hash(data1), DrawComp::hash(data2));
+}
+
+TEST_F(Draw_DrawCompTests, Hash_ChangedContent)
+{
+    //! [GIVEN] Recorded content
+    uint64_t origin = DrawComp::hash(record(5.0, u"text"));
+
+    //! [THEN] Any change of the content changes the hash
+    EXPECT_NE(origin, DrawComp::hash(record(6.0, u"text")));
+    EXPECT_NE(origin, DrawComp::hash(record(5.0, u"test")));
+}
@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_DrawDataPaintTests : public ::testing::Test
+{
+public:
+    DrawData record() const
+    {
+        auto provider = std::make_shared<BufferedPaintProvider>();
+        Painter painter(provider, "record");
+
+        painter.translate(10.0, 0.0);
+        painter.setPen(Pen(Color::black, 2.0));
+        painter.drawLine(PointF(0.0, 0.0), PointF(5.0, 0.0));
+
+        painter.translate(0.0, 20.0);
+        Font font(u"Bravura");
+        painter.setFont(font);
+        painter.drawSymbol(PointF(1.0, 1.0), 0xE0A4);
+        painter.drawText(PointF(2.0, 2.0), u"text");
+
+        painter.endDraw();
+        return provider->drawData();
+    }
+};
+
+TEST_F(Draw_DrawDataPaintTests, Replay)
+{
+    //! [GIVEN] Recorded data
+    DrawData data = record();
+
+    //! [WHEN] Replayed with a base transform
+    auto provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "replay");
+        painter.translate(100.0, 200.0);
+        DrawDataPaint::paint(&painter, data);
+        painter.endDraw();
+    }
+
+    //! [THEN] The same primitives are drawn, offset by the base transform
+    std::vector<const DrawData::Data*> datas;
+    for (const DrawData::Object& obj : provider->drawData().objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            if (!d.empty()) {
+                datas.push_back(&d);
+            }
+        }
+    }
+
+    ASSERT_EQ(datas.size(), 2);
+
+    ASSERT_EQ(datas.at(0)->polygons.size(), 1);
+    EXPECT_TRUE(datas.at(0)->state.transform == Transform().translate(110.0, 200.0));
+    EXPECT_DOUBLE_EQ(datas.at(0)->state.pen.widthF(), 2.0);
+
+    ASSERT_EQ(datas.at(1)->texts.size(), 2);
+    EXPECT_TRUE(datas.at(1)->state.transform == Transform().translate(110.0, 220.0));
+    EXPECT_EQ(datas.at(1)->texts.at(0).text, String::fromUcs4(U"\U0000E0A4"));
+    EXPECT_TRUE(datas.at(1)->texts.at(0).isSymbol);
+    EXPECT_EQ(datas.at(1)->texts.at(1).text, String(u"text"));
+    EXPECT_FALSE(datas.at(1)->texts.at(1).isSymbol);
+}
+
+TEST_F(Draw_DrawDataPaintTests, OneLetterText_ReplayedAsText)
+{
+    //! [GIVEN] One letter underlined texts (ex. lyrics, fingerings) and a symbol
+    auto provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "record");
+        Font font(u"Edwin");
+        font.setUnderline(true);
+        painter.setFont(font);
+        painter.drawText(PointF(0.0, 0.0), u"a");
+        painter.drawText(PointF(10.0, 0.0), u"1");
+        painter.drawSymbol(PointF(20.0, 0.0), 0xE0A4);
+        painter.endDraw();
+    }
+
+    //! [WHEN] Replayed
+    auto replayProvider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(replayProvider, "replay");
+        DrawDataPaint::paint(&painter, provider->drawData());
+        painter.endDraw();
+    }
+
+    //! [THEN] The texts are drawn as texts with their font, only the symbol is drawn as a symbol
+    std::vector<DrawText> texts;
+    for (const DrawData::Object& obj : replayProvider->drawData().objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            for (const DrawText& t : d.texts) {
+                EXPECT_TRUE(d.state.font.underline());
+                texts.push_back(t);
+            }
+        }
+    }
+
+    ASSERT_EQ(texts.size(), 3);
+    EXPECT_EQ(texts.at(0).text, String(u"a"));
+    EXPECT_FALSE(texts.at(0).isSymbol);
+    EXPECT_EQ(texts.at(1).text, String(u"1"));
+    EXPECT_FALSE(texts.at(1).isSymbol);
+    EXPECT_TRUE(texts.at(2).isSymbol);
+}
+
+TEST_F(Draw_DrawDataPaintTests, KeepsPaintOrder)
+{
+    //! [GIVEN] A text and a line over it, with the same state
+    auto provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "record");
+        painter.setPen(Pen(Color::black, 1.0));
+        painter.drawText(PointF(0.0, 0.0), u"text");
+        painter.drawLine(PointF(0.0, 0.0), PointF(5.0, 0.0));
+        painter.endDraw();
+    }
+
+    //! [THEN] The line is recorded in a later data, so it is replayed after the text
+    std::vector<const DrawData::Data*> datas;
+    for (const DrawData::Object& obj : provider->drawData().objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            if (!d.empty()) {
+                datas.push_back(&d);
+            }
+        }
+    }
+
+    ASSERT_EQ(datas.size(), 2);
+    EXPECT_EQ(datas.at(0)->texts.size(), 1);
+    EXPECT_EQ(datas.at(1)->polygons.size(), 1);
+}
+
+TEST_F(Draw_DrawDataPaintTests, Clip_SameAsDirectPaint)
+{
+    auto paint = [](Painter& painter) {
+        painter.scale(2.0, 2.0);
+        painter.setClipping(true);
+        painter.setClipRect(RectF(10.0, 10.0, 20.0, 20.0));
+        painter.fillRect(RectF(0.0, 0.0, 50.0, 50.0), Color::black);
+        painter.setClipping(false);
+        painter.fillRect(RectF(40.0, 0.0, 5.0, 5.0), Color::black);
+    };
+
+    auto image = []() {
+        QImage image(100, 100, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::white);
+        return image;
+    };
+
+    //! [GIVEN] Painted directly, with a clip
+    QImage direct = image();
+    {
+        Painter painter(&direct, "direct");
+        paint(painter);
+        painter.endDraw();
+    }
+
+    //! [WHEN] The same is recorded and replayed
+    auto provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "record");
+        paint(painter);
+        painter.endDraw();
+    }
+
+    QImage replayed = image();
+    {
+        Painter painter(&replayed, "replay");
+        DrawDataPaint::paint(&painter, provider->drawData());
+        painter.endDraw();
+    }
+
+    //! [THEN] The clip is kept, the images are the same
+    EXPECT_EQ(replayed.pixel(10, 10), qRgb(255, 255, 255));
+    EXPECT_EQ(replayed.pixel(30, 30), qRgb(0, 0, 0));
+    EXPECT_EQ(replayed.pixel(85, 5), qRgb(0, 0, 0));
+    EXPECT_TRUE(replayed == direct);
+}
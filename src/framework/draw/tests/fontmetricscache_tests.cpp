@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "draw/internal/fontmetricscache.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_FontMetricsCacheTests : public ::testing::Test
+{
+public:
+    Font font(const String& family, double size) const
+    {
+        Font f(family);
+        f.setPointSizeF(size);
+        return f;
+    }
+};
+
+TEST_F(Draw_FontMetricsCacheTests, Metric)
+{
+    FontMetricsCache cache;
+    int computed = 0;
+    auto compute = [&computed]() { ++computed; return 12.5; };
+
+    //! [GIVEN] Metric was requested
+    EXPECT_DOUBLE_EQ(cache.metric(font(u"Edwin", 10.0), FontMetricsCache::Metric::Ascent, compute), 12.5);
+
+    //! [WHEN] Requested again for an equal font
+    EXPECT_DOUBLE_EQ(cache.metric(font(u"Edwin", 10.0), FontMetricsCache::Metric::Ascent, compute), 12.5);
+
+    //! [THEN] Computed once
+    EXPECT_EQ(computed, 1);
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 1);
+
+    //! [WHEN] Requested another metric or another size
+    cache.metric(font(u"Edwin", 10.0), FontMetricsCache::Metric::Descent, compute);
+    cache.metric(font(u"Edwin", 11.0), FontMetricsCache::Metric::Ascent, compute);
+
+    //! [THEN] Computed for each
+    EXPECT_EQ(computed, 3);
+}
+
+TEST_F(Draw_FontMetricsCacheTests, FontKey_Normalized)
+{
+    //! [GIVEN] Fonts that differ in properties that don't affect metrics
+    Font f1 = font(u"Edwin", 10.0);
+    Font f2 = font(u"Edwin", 10.0);
+    f2.setUnderline(true);
+    f2.setStrike(true);
+    f2.setWeight(Font::Light); // overridden by the bold flag
+
+    //! [THEN] Same key
+    EXPECT_TRUE(FontMetricsCache::fontKey(f1) == FontMetricsCache::fontKey(f2));
+
+    //! [GIVEN] Fonts that differ in properties that affect metrics
+    Font f3 = font(u"Edwin", 10.0);
+    f3.setBold(true);
+    Font f4 = font(u"Edwin", 10.0);
+    f4.setItalic(true);
+
+    //! [THEN] Different keys
+    EXPECT_FALSE(FontMetricsCache::fontKey(f1) == FontMetricsCache::fontKey(f3));
+    EXPECT_FALSE(FontMetricsCache::fontKey(f1) == FontMetricsCache::fontKey(f4));
+}
+
+TEST_F(Draw_FontMetricsCacheTests, Strings)
+{
+    FontMetricsCache cache;
+    Font f = font(u"Edwin", 10.0);
+
+    //! [GIVEN] Advance and bbox of a string and a char
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(f, String(u"la"), []() { return 7.0; }), 7.0);
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(f, U'l', []() { return 3.0; }), 3.0);
+    EXPECT_EQ(cache.boundingRect(f, String(u"la"), []() { return RectF(0, -5, 7, 6); }), RectF(0, -5, 7, 6));
+    EXPECT_EQ(cache.tightBoundingRect(f, String(u"la"), []() { return RectF(1, -4, 6, 4); }), RectF(1, -4, 6, 4));
+
+    //! [THEN] Cached values are returned, not the computed ones
+    auto fail = []() { ADD_FAILURE(); return 0.0; };
+    auto failRect = []() { ADD_FAILURE(); return RectF(); };
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(f, String(u"la"), fail), 7.0);
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(f, U'l', fail), 3.0);
+    EXPECT_EQ(cache.boundingRect(f, String(u"la"), failRect), RectF(0, -5, 7, 6));
+    EXPECT_EQ(cache.tightBoundingRect(f, String(u"la"), failRect), RectF(1, -4, 6, 4));
+
+    //! [WHEN] Cleared
+    cache.clear();
+
+    //! [THEN] Computed again
+    EXPECT_DOUBLE_EQ(cache.horizontalAdvance(f, String(u"la"), []() { return 8.0; }), 8.0);
+}
+
+TEST_F(Draw_FontMetricsCacheTests, Threads)
+{
+    FontMetricsCache cache;
+    Font f = font(u"Edwin", 10.0);
+
+    //! [GIVEN] Several threads request the same values
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, &f]() {
+            for (int i = 0; i < 1000; ++i) {
+                String str = String::number(i % 100);
+                double val = cache.horizontalAdvance(f, str, [i]() { return static_cast<double>(i % 100); });
+                EXPECT_DOUBLE_EQ(val, static_cast<double>(i % 100));
+            }
+        });
+    }
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    //! [THEN] All requests are counted, most of them are hits
+    FontMetricsCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, 4000);
+    EXPECT_GE(stats.hits, 3600);
+}
+
+TEST_F(Draw_FontMetricsCacheTests, Disabled)
+{
+    FontMetricsCache cache;
+    Font f = font(u"Edwin", 10.0);
+    int computed = 0;
+    auto compute = [&computed]() { ++computed; return 7.0; };
+
+    //! [GIVEN] The cache is disabled
+    cache.setEnabled(false);
+
+    //! [WHEN] The same values are requested twice
+    cache.horizontalAdvance(f, String(u"la"), compute);
+    cache.horizontalAdvance(f, String(u"la"), compute);
+    cache.metric(f, FontMetricsCache::Metric::Ascent, compute);
+    cache.metric(f, FontMetricsCache::Metric::Ascent, compute);
+
+    //! [THEN] Computed each time, nothing is counted
+    EXPECT_EQ(computed, 4);
+    EXPECT_EQ(cache.stats().hits + cache.stats().misses, 0);
+
+    //! [WHEN] Enabled again
+    cache.setEnabled(true);
+    cache.horizontalAdvance(f, String(u"la"), compute);
+    cache.horizontalAdvance(f, String(u"la"), compute);
+
+    //! [THEN] Nothing was stored while disabled, the second request is a hit
+    EXPECT_EQ(computed, 5);
+    EXPECT_EQ(cache.stats().hits, 1);
+}
@@ -0,0 +1,217 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+namespace {
+class RecordingPaintProvider : public BufferedPaintProvider
+{
+public:
+    struct Run {
+        std::vector<PointF> points;
+        std::vector<char32_t> codes;
+        Transform transform;
+        Font font;
+    };
+
+    void drawSymbols(const PointF* points, const char32_t* ucs4Codes, size_t count) override
+    {
+        Run run;
+        run.points.assign(points, points + count);
+        run.codes.assign(ucs4Codes, ucs4Codes + count);
+        run.transform = transform();
+        run.font = font();
+        runs.push_back(run);
+        events.push_back("symbols");
+
+        BufferedPaintProvider::drawSymbols(points, ucs4Codes, count);
+    }
+
+    void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) override
+    {
+        events.push_back("polygon");
+        BufferedPaintProvider::drawPolygon(points, pointCount, mode);
+    }
+
+    void save() override
+    {
+        events.push_back("save");
+        BufferedPaintProvider::save();
+    }
+
+    void restore() override
+    {
+        events.push_back("restore");
+        BufferedPaintProvider::restore();
+    }
+
+    void setClipRect(const RectF& rect) override
+    {
+        events.push_back("clip");
+        BufferedPaintProvider::setClipRect(rect);
+    }
+
+    std::vector<Run> runs;
+    std::vector<std::string> events;
+};
+}
+
+class Draw_PainterTests : public ::testing::Test
+{
+public:
+    Font font(const String& family, double size) const
+    {
+        Font f(family);
+        f.setPointSizeF(size);
+        return f;
+    }
+
+    //! NOTE Same sequence of calls as SymbolFont::draw
+    void drawSym(Painter& painter, const Font& f, double mag, const PointF& pos, char32_t code) const
+    {
+        painter.save();
+        painter.scale(mag, mag);
+        painter.setFont(f);
+        painter.drawSymbol(PointF(pos.x() / mag, pos.y() / mag), code);
+        painter.restore();
+    }
+};
+
+TEST_F(Draw_PainterTests, SymbolRun_Batched)
+{
+    auto provider = std::make_shared<RecordingPaintProvider>();
+    Painter painter(provider, "test");
+    painter.translate(10.0, 20.0);
+
+    //! [GIVEN] Symbols drawn with one state, at different positions (same sequence of calls as SymbolFont::draw of a list)
+    Font f = font(u"Bravura", 20.0);
+    painter.save();
+    painter.scale(0.5, 0.5);
+    painter.setFont(f);
+    painter.drawSymbol(PointF(0.0, 0.0), 0xE0A4);
+    painter.drawSymbol(PointF(8.0, 4.0), 0xE0A4);
+    painter.restore();
+
+    //! [WHEN] The painter ends
+    painter.endDraw();
+
+    //! [THEN] One run is passed to the provider
+    ASSERT_EQ(provider->runs.size(), 1);
+    const RecordingPaintProvider::Run& run = provider->runs.front();
+    ASSERT_EQ(run.codes.size(), 2);
+    EXPECT_EQ(run.font, f);
+
+    //! [THEN] The symbols keep their device positions
+    PointF first = run.transform.map(run.points.at(0));
+    PointF second = run.transform.map(run.points.at(1));
+    EXPECT_DOUBLE_EQ(first.x(), 10.0);
+    EXPECT_DOUBLE_EQ(first.y(), 20.0);
+    EXPECT_DOUBLE_EQ(second.x(), 14.0);
+    EXPECT_DOUBLE_EQ(second.y(), 22.0);
+}
+
+TEST_F(Draw_PainterTests, SymbolRun_SplitByState)
+{
+    auto provider = std::make_shared<RecordingPaintProvider>();
+    Painter painter(provider, "test");
+
+    //! [GIVEN] Symbols separated by changes of the font, the pen, the brush and the transform
+    painter.setFont(font(u"Bravura", 20.0));
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.setFont(font(u"Leland", 20.0));
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.setPen(Color::redColor);
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.setBrush(Color::redColor);
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.translate(5.0, 5.0);
+    painter.drawSymbol(PointF(), 0xE0A4);
+
+    painter.endDraw();
+
+    //! [THEN] Each change starts a new run
+    ASSERT_EQ(provider->runs.size(), 5);
+    EXPECT_EQ(provider->runs.at(0).font, font(u"Bravura", 20.0));
+    EXPECT_EQ(provider->runs.at(1).font, font(u"Leland", 20.0));
+    EXPECT_TRUE(provider->runs.at(3).transform == Transform());
+    EXPECT_TRUE(provider->runs.at(4).transform == Transform().translate(5.0, 5.0));
+}
+
+TEST_F(Draw_PainterTests, SymbolRun_FlushedBySaveRestore)
+{
+    auto provider = std::make_shared<RecordingPaintProvider>();
+    Painter painter(provider, "test");
+
+    //! [GIVEN] A symbol is drawn
+    Font f = font(u"Bravura", 20.0);
+    painter.setFont(f);
+    painter.drawSymbol(PointF(), 0xE0A4);
+
+    //! [WHEN] The state is saved
+    painter.save();
+
+    //! [THEN] The symbol is passed to the provider before the state is saved
+    std::vector<std::string> expected = { "symbols", "save" };
+    EXPECT_EQ(provider->events, expected);
+
+    //! [WHEN] A symbol is drawn with a clip and the state is restored
+    painter.setClipRect(RectF(0.0, 0.0, 10.0, 10.0));
+    painter.translate(5.0, 5.0);
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.restore();
+
+    //! [THEN] The symbol is passed to the provider with the clip and the transform, before the restore
+    expected = { "symbols", "save", "clip", "symbols", "restore" };
+    EXPECT_EQ(provider->events, expected);
+    ASSERT_EQ(provider->runs.size(), 2);
+    EXPECT_TRUE(provider->runs.at(1).transform == Transform().translate(5.0, 5.0));
+
+    painter.endDraw();
+}
+
+TEST_F(Draw_PainterTests, SymbolRun_KeepsDrawOrder)
+{
+    auto provider = std::make_shared<RecordingPaintProvider>();
+    Painter painter(provider, "test");
+
+    //! [GIVEN] A line is drawn between symbols
+    Font f = font(u"Bravura", 20.0);
+    painter.setFont(f);
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.drawSymbol(PointF(), 0xE0A4);
+    painter.drawLine(PointF(0.0, 0.0), PointF(10.0, 0.0));
+    painter.drawSymbol(PointF(), 0xE0A4);
+
+    painter.endDraw();
+
+    //! [THEN] The symbols before the line are drawn before it
+    std::vector<std::string> expected = { "symbols", "polygon", "symbols" };
+    EXPECT_EQ(provider->events, expected);
+}
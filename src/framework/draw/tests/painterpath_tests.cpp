@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "draw/types/painterpath.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class Draw_PainterPathTests : public ::testing::Test
+{
+public:
+    PainterPath slurLikePath() const
+    {
+        PainterPath path;
+        path.moveTo(PointF(0.0, 0.0));
+        path.cubicTo(PointF(10.0, -10.0), PointF(30.0, -10.0), PointF(40.0, 0.0));
+        path.cubicTo(PointF(30.0, -8.0), PointF(10.0, -8.0), PointF(0.0, 0.0));
+        return path;
+    }
+
+    double maxDistanceToPolygon(const Bezier& b, const PolygonF& polygon) const
+    {
+        double maxDistance = 0.0;
+        for (int i = 0; i <= 100; ++i) {
+            PointF p = b.pointAt(i / 100.0);
+
+            double nearest = std::numeric_limits<double>::max();
+            for (size_t j = 1; j < polygon.size(); ++j) {
+                nearest = std::min(nearest, distanceToSegment(p, polygon[j - 1], polygon[j]));
+            }
+            maxDistance = std::max(maxDistance, nearest);
+        }
+        return maxDistance;
+    }
+
+private:
+    static double distanceToSegment(const PointF& p, const PointF& a, const PointF& b)
+    {
+        PointF ab = b - a;
+        double len2 = ab.x() * ab.x() + ab.y() * ab.y();
+        double t = len2 > 0.0 ? ((p.x() - a.x()) * ab.x() + (p.y() - a.y()) * ab.y()) / len2 : 0.0;
+        t = std::clamp(t, 0.0, 1.0);
+        PointF q = a + ab * t;
+        return std::hypot(p.x() - q.x(), p.y() - q.y());
+    }
+};
+
+TEST_F(Draw_PainterPathTests, HasCurves)
+{
+    PainterPath lines;
+    lines.moveTo(PointF(0.0, 0.0));
+    lines.lineTo(PointF(10.0, 0.0));
+    EXPECT_FALSE(lines.hasCurves());
+
+    EXPECT_TRUE(slurLikePath().hasCurves());
+}
+
+TEST_F(Draw_PainterPathTests, ToSubpathPolygons_WithinTolerance)
+{
+    //! GIVEN A curve
+    Bezier b = Bezier::fromPoints(PointF(0.0, 0.0), PointF(10.0, -10.0), PointF(30.0, -10.0), PointF(40.0, 0.0));
+
+    PainterPath path;
+    path.moveTo(b.pt1());
+    path.cubicTo(b.pt2(), b.pt3(), b.pt4());
+
+    for (double tolerance : { 1.0, 0.1, 0.01 }) {
+        //! DO Flatten
+        std::vector<PolygonF> polygons = path.toSubpathPolygons(tolerance);
+
+        //! CHECK The ends are kept and the curve is not farther than the tolerance
+        ASSERT_EQ(polygons.size(), 1);
+        const PolygonF& polygon = polygons.front();
+        EXPECT_EQ(polygon.front(), b.pt1());
+        EXPECT_EQ(polygon.back(), b.pt4());
+        EXPECT_LE(maxDistanceToPolygon(b, polygon), tolerance);
+    }
+
+    //! CHECK A finer tolerance gives more points
+    EXPECT_LT(path.toSubpathPolygons(1.0).front().size(), path.toSubpathPolygons(0.01).front().size());
+}
+
+TEST_F(Draw_PainterPathTests, ToSubpathPolygons_Subpaths)
+{
+    //! GIVEN A closed curved shape and a rect
+    PainterPath path = slurLikePath();
+    path.addRect(RectF(0.0, 10.0, 5.0, 5.0));
+
+    //! DO Flatten
+    std::vector<PolygonF> polygons = path.toSubpathPolygons(0.1);
+
+    //! CHECK Each subpath is a polygon, the lines are kept as they are
+    ASSERT_EQ(polygons.size(), 2);
+    EXPECT_EQ(polygons[0].front(), PointF(0.0, 0.0));
+    EXPECT_EQ(polygons[0].back(), PointF(0.0, 0.0));
+    EXPECT_EQ(polygons[1].size(), 5);
+    EXPECT_EQ(polygons[1][2], PointF(5.0, 15.0));
+}
@@ -21,6 +21,9 @@
  */
 
 #include "bezier.h"
+
+#include <cmath>
+
 #include "realfn.h"
 
 using namespace mu;
@@ -106,3 +109,52 @@ PointF Bezier::pointAt(double t) const
     }
     return PointF(x, y);
 }
+
+void Bezier::addToPolygon(PolygonF& polygon, double tolerance) const
+{
+    //! NOTE Enough for a curve across a page at a tolerance of a thousandth of a pixel
+    constexpr int MAX_DEPTH = 16;
+
+    struct Part {
+        Bezier bezier;
+        int depth = 0;
+    };
+
+    std::vector<Part> stack;
+    stack.push_back({ *this, 0 });
+
+    while (!stack.empty()) {
+        Part part = stack.back();
+        stack.pop_back();
+
+        if (part.depth >= MAX_DEPTH || part.bezier.isFlat(tolerance)) {
+            polygon.push_back(part.bezier.pt4());
+            continue;
+        }
+
+        Bezier left;
+        Bezier right = part.bezier;
+        right.parameterSplitLeft(0.5, &left);
+
+        // the left half is drawn first
+        stack.push_back({ right, part.depth + 1 });
+        stack.push_back({ left, part.depth + 1 });
+    }
+}
+
+bool Bezier::isFlat(double tolerance) const
+{
+    double dx = m_x4 - m_x1;
+    double dy = m_y4 - m_y1;
+    double length = std::sqrt(dx * dx + dy * dy);
+
+    auto distance = [this, dx, dy, length](double x, double y) {
+        if (RealIsNull(length)) {
+            return std::hypot(x - m_x1, y - m_y1);
+        }
+        return std::fabs((x - m_x1) * dy - (y - m_y1) * dx) / length;
+    };
+
+    //! NOTE The curve lies in the hull of the control points
+    return std::max(distance(m_x2, m_y2), distance(m_x3, m_y3)) <= tolerance;
+}
@@ -43,8 +43,13 @@ public:
 
     PointF pointAt(double t) const;
 
+    //! NOTE Appends the curve as line segments (without the start point),
+    //! no point of the curve is farther than the tolerance from the segments
+    void addToPolygon(PolygonF& polygon, double tolerance) const;
+
 private:
     void parameterSplitLeft(double t, Bezier* left);
+    bool isFlat(double tolerance) const;
 
     friend class PainterPath;
 
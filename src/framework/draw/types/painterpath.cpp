@@ -375,6 +375,54 @@ void PainterPath::setFillRule(PainterPath::FillRule fillRule)
     m_fillRule = fillRule;
 }
 
+bool PainterPath::hasCurves() const
+{
+    for (const Element& e : m_elements) {
+        if (e.isCurveTo()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<PolygonF> PainterPath::toSubpathPolygons(double tolerance) const
+{
+    std::vector<PolygonF> polygons;
+    PolygonF current;
+
+    for (size_t i = 0; i < m_elements.size(); ++i) {
+        const Element& e = m_elements[i];
+        switch (e.type) {
+        case ElementType::MoveToElement:
+            if (current.size() > 1) {
+                polygons.push_back(std::move(current));
+            }
+            current = PolygonF();
+            current.push_back(PointF(e.x, e.y));
+            break;
+        case ElementType::LineToElement:
+            current.push_back(PointF(e.x, e.y));
+            break;
+        case ElementType::CurveToElement: {
+            assert(i + 2 < m_elements.size() && !current.empty());
+            const Element& c2 = m_elements[i + 1];
+            const Element& end = m_elements[i + 2];
+            Bezier b = Bezier::fromPoints(current.back(), PointF(e.x, e.y), PointF(c2.x, c2.y), PointF(end.x, end.y));
+            b.addToPolygon(current, tolerance);
+            i += 2;
+        } break;
+        case ElementType::CurveToDataElement:
+            break;
+        }
+    }
+
+    if (current.size() > 1) {
+        polygons.push_back(std::move(current));
+    }
+
+    return polygons;
+}
+
 void PainterPath::ensureData()
 {
     if (m_elements.empty()) {
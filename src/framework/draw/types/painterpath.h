@@ -128,6 +128,12 @@ public:
     PainterPath::FillRule fillRule() const;
     void setFillRule(PainterPath::FillRule fillRule);
 
+    bool hasCurves() const;
+
+    //! NOTE The subpaths with the curves replaced by line segments,
+    //! no point of a curve is farther than the tolerance from its segments
+    std::vector<PolygonF> toSubpathPolygons(double tolerance) const;
+
 #ifndef NO_QT_SUPPORT
     QPainterPath toQPainterPath() const { return toQPainterPath(*this); }
     static QPainterPath toQPainterPath(const PainterPath& path);
@@ -21,6 +21,8 @@
  */
 #include "drawcomp.h"
 
+#include <cstring>
+
 #include "global/realfn.h"
 #include "log.h"
 
@@ -207,6 +209,10 @@ static bool isEqual(const DrawData::State& s1, const DrawData::State& s2, DrawCo
         return false;
     }
 
+    if (s1.isClipping != s2.isClipping || (s1.isClipping && s1.clipRect != s2.clipRect)) {
+        return false;
+    }
+
     return true;
 }
 
@@ -298,6 +304,10 @@ static bool isEqual(const DrawText& v1, const DrawText& v2, DrawComp::Tolerance
         return false;
     }
 
+    if (v1.isSymbol != v2.isSymbol) {
+        return false;
+    }
+
     return true;
 }
 
@@ -476,3 +486,161 @@ Diff DrawComp::compare(const DrawDataPtr& data, const DrawDataPtr& origin, Toler
 
     return diff;
 }
+
+namespace mu::draw::comp {
+struct Hasher {
+    uint64_t value = 14695981039346656037ULL;
+
+    void add(uint64_t v)
+    {
+        //! NOTE FNV-1a over 64-bit words
+        value ^= v;
+        value *= 1099511628211ULL;
+    }
+
+    void add(double v)
+    {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &v, sizeof(bits));
+        add(bits);
+    }
+
+    void add(int v) { add(static_cast<uint64_t>(static_cast<int64_t>(v))); }
+    void add(bool v) { add(static_cast<uint64_t>(v)); }
+    void add(const String& v) { add(static_cast<uint64_t>(v.hash())); }
+    void add(const std::string& v) { add(static_cast<uint64_t>(std::hash<std::string> {}(v))); }
+    void add(const PointF& v) { add(v.x()); add(v.y()); }
+    void add(const RectF& v) { add(v.x()); add(v.y()); add(v.width()); add(v.height()); }
+
+    void add(const Color& v)
+    {
+        add(v.red());
+        add(v.green());
+        add(v.blue());
+        add(v.alpha());
+    }
+
+    void add(const Pen& v)
+    {
+        add(static_cast<int>(v.style()));
+        add(v.widthF());
+        add(v.color());
+        add(static_cast<int>(v.capStyle()));
+        add(static_cast<int>(v.joinStyle()));
+        for (double d : v.dashPattern()) {
+            add(d);
+        }
+    }
+
+    void add(const Brush& v)
+    {
+        add(static_cast<int>(v.style()));
+        add(v.color());
+    }
+
+    void add(const Font& v)
+    {
+        add(v.family());
+        add(v.pointSizeF());
+        add(static_cast<int>(v.weight()));
+        add(v.italic());
+        add(v.underline());
+        add(v.strike());
+    }
+
+    void add(const Transform& v)
+    {
+        add(v.m11());
+        add(v.m12());
+        add(v.m13());
+        add(v.m21());
+        add(v.m22());
+        add(v.m23());
+        add(v.m31());
+        add(v.m32());
+        add(v.m33());
+    }
+
+    void add(const PainterPath& v)
+    {
+        add(static_cast<int>(v.fillRule()));
+        for (size_t i = 0; i < v.elementCount(); ++i) {
+            PainterPath::Element e = v.elementAt(i);
+            add(static_cast<int>(e.type));
+            add(e.x);
+            add(e.y);
+        }
+    }
+
+    void add(const Pixmap& v)
+    {
+        add(static_cast<uint64_t>(v.key()));
+    }
+};
+} // mu::draw::comp
+
+uint64_t DrawComp::hash(const DrawData& data)
+{
+    comp::Hasher h;
+    for (const DrawData::Object& obj : data.objects) {
+        h.add(obj.name);
+        h.add(obj.pagePos);
+
+        for (const DrawData::Data& d : obj.datas) {
+            h.add(d.state.pen);
+            h.add(d.state.brush);
+            h.add(d.state.font);
+            h.add(d.state.transform);
+            h.add(d.state.isAntialiasing);
+            h.add(static_cast<int>(d.state.compositionMode));
+            h.add(d.state.isClipping);
+            if (d.state.isClipping) {
+                h.add(d.state.clipRect);
+            }
+
+            h.add(static_cast<uint64_t>(d.paths.size()));
+            for (const DrawPath& p : d.paths) {
+                h.add(p.path);
+                h.add(p.pen);
+                h.add(p.brush);
+                h.add(static_cast<int>(p.mode));
+            }
+
+            h.add(static_cast<uint64_t>(d.polygons.size()));
+            for (const DrawPolygon& p : d.polygons) {
+                h.add(static_cast<int>(p.mode));
+                for (const PointF& pt : p.polygon) {
+                    h.add(pt);
+                }
+            }
+
+            h.add(static_cast<uint64_t>(d.texts.size()));
+            for (const DrawText& t : d.texts) {
+                h.add(t.pos);
+                h.add(t.text);
+                h.add(t.isSymbol);
+            }
+
+            h.add(static_cast<uint64_t>(d.rectTexts.size()));
+            for (const DrawRectText& t : d.rectTexts) {
+                h.add(t.rect);
+                h.add(t.flags);
+                h.add(t.text);
+            }
+
+            h.add(static_cast<uint64_t>(d.pixmaps.size()));
+            for (const DrawPixmap& p : d.pixmaps) {
+                h.add(p.pos);
+                h.add(p.pm);
+            }
+
+            h.add(static_cast<uint64_t>(d.tiledPixmap.size()));
+            for (const DrawTiledPixmap& p : d.tiledPixmap) {
+                h.add(p.rect);
+                h.add(p.pm);
+                h.add(p.offset);
+            }
+        }
+    }
+    return h.value;
+}
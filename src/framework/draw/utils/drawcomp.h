@@ -35,6 +35,10 @@ public:
     };
 
     static Diff compare(const DrawDataPtr& data, const DrawDataPtr& origin, Tolerance tolerance = Tolerance());
+
+    //! NOTE Hash of the painted content (exact, without tolerance),
+    //! the same content recorded again has the same hash
+    static uint64_t hash(const DrawData& data);
 };
 }
 
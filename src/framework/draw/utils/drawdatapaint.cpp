@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "drawdatapaint.h"
+
+#include "../painter.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+static void drawPolygon(Painter* painter, const DrawPolygon& pl)
+{
+    switch (pl.mode) {
+    case PolygonMode::OddEven:
+        painter->drawPolygon(pl.polygon.data(), pl.polygon.size(), FillRule::OddEvenFill);
+        break;
+    case PolygonMode::Winding:
+        painter->drawPolygon(pl.polygon.data(), pl.polygon.size(), FillRule::WindingFill);
+        break;
+    case PolygonMode::Convex:
+        painter->drawConvexPolygon(pl.polygon.data(), pl.polygon.size());
+        break;
+    case PolygonMode::Polyline:
+        painter->drawPolyline(pl.polygon.data(), pl.polygon.size());
+        break;
+    }
+}
+
+static void drawText(Painter* painter, const DrawText& t)
+{
+    //! NOTE Symbols are replayed as symbols so they are drawn as glyph runs again,
+    //! other texts (even one letter ones) keep the text drawing: underline, strike out, shaping
+    if (t.isSymbol) {
+        std::u32string ucs4 = t.text.toStdU32String();
+        if (ucs4.size() == 1) {
+            painter->drawSymbol(t.pos, ucs4.front());
+            return;
+        }
+    }
+
+    painter->drawText(t.pos, t.text);
+}
+
+void DrawDataPaint::paint(Painter* painter, const DrawData& data)
+{
+    const Transform base = painter->worldTransform();
+    const DrawData::State defaultState;
+
+    painter->save();
+
+    //! NOTE Changing antialiasing or composition flushes the pending symbols,
+    //! so they are set only if differ from the previous data
+    bool isAntialiasing = defaultState.isAntialiasing;
+    CompositionMode compositionMode = defaultState.compositionMode;
+    bool first = true;
+
+    //! NOTE The recorded clip replaces the clip of the painter,
+    //! so the painter state is saved before and restored when the recorded clip ends
+    bool isClipping = false;
+    RectF clipRect;
+
+    for (const DrawData::Object& obj : data.objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            if (d.empty()) {
+                continue;
+            }
+
+            const DrawData::State& st = d.state;
+            if (st.isClipping != isClipping || (st.isClipping && st.clipRect != clipRect)) {
+                if (isClipping) {
+                    painter->restore();
+                }
+
+                isClipping = st.isClipping;
+                clipRect = st.clipRect;
+
+                if (isClipping) {
+                    painter->save();
+                    painter->setWorldTransform(base);
+                    painter->setClipRect(clipRect);
+                    painter->setClipping(true);
+                }
+
+                //! NOTE The restored state may differ
+                first = true;
+            }
+
+            if (first || st.isAntialiasing != isAntialiasing) {
+                isAntialiasing = st.isAntialiasing;
+                painter->setAntialiasing(isAntialiasing);
+            }
+
+            if (first || st.compositionMode != compositionMode) {
+                compositionMode = st.compositionMode;
+                painter->setCompositionMode(compositionMode);
+            }
+            first = false;
+
+            painter->setWorldTransform(st.transform * base);
+            painter->setFont(st.font);
+
+            for (const DrawPath& path : d.paths) {
+                painter->setPen(path.pen);
+                painter->setBrush(path.brush);
+                painter->drawPath(path.path);
+            }
+
+            painter->setPen(st.pen);
+            painter->setBrush(st.brush);
+
+            for (const DrawPolygon& pl : d.polygons) {
+                if (pl.polygon.empty()) {
+                    continue;
+                }
+                drawPolygon(painter, pl);
+            }
+
+            for (const DrawText& t : d.texts) {
+                drawText(painter, t);
+            }
+
+            for (const DrawRectText& t : d.rectTexts) {
+                painter->drawText(t.rect, t.flags, t.text);
+            }
+
+            for (const DrawPixmap& px : d.pixmaps) {
+                painter->drawPixmap(px.pos, px.pm);
+            }
+
+            for (const DrawTiledPixmap& px : d.tiledPixmap) {
+                painter->drawTiledPixmap(px.rect, px.pm, px.offset);
+            }
+        }
+    }
+
+    if (isClipping) {
+        painter->restore();
+    }
+
+    painter->restore();
+
+    //! NOTE Not every provider restores the transform
+    painter->setWorldTransform(base);
+}
@@ -285,6 +285,9 @@ static JsonObject toObj(const DrawText& text)
     JsonObject o;
     o["pos"] = toArr(text.pos);
     o["text"] = text.text;
+    if (text.isSymbol) {
+        o["symbol"] = true;
+    }
     return o;
 }
 
@@ -292,6 +295,7 @@ static void fromObj(const JsonObject& obj, DrawText& text)
 {
     fromArr(obj["pos"].toArray(), text.pos);
     text.text = obj["text"].toString();
+    text.isSymbol = obj["symbol"].toBool();
 }
 
 static JsonObject toObj(const DrawRectText& text)
@@ -21,6 +21,7 @@
  */
 #include "allocator.h"
 
+#include <cassert>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
@@ -30,7 +31,7 @@
 
 using namespace mu;
 
-int ObjectAllocator::used = 0;
+std::atomic<int> ObjectAllocator::used { 0 };
 size_t ObjectAllocator::DEFAULT_BLOCK_SIZE(1024 * 256); // 256 kB
 
 static inline size_t align(size_t n)
@@ -66,6 +67,8 @@ void* ObjectAllocator::alloc(size_t size)
 {
     size = align(size);
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     if (!m_chunkSize) {
         m_chunkSize = size;
     }
@@ -95,6 +98,8 @@ void* ObjectAllocator::alloc(size_t size)
 
 void ObjectAllocator::free(void* chunk, size_t size)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
 #ifdef NDEBUG
     UNUSED(size);
 #endif
@@ -113,6 +118,8 @@ void ObjectAllocator::free(void* chunk, size_t size)
 
 void ObjectAllocator::cleanup()
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     if (m_blocks.empty()) {
         return;
     }
@@ -187,6 +194,8 @@ void* ObjectAllocator::not_supported(const char* info)
 
 ObjectAllocator::Info ObjectAllocator::stateInfo() const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     Info info;
     info.module = m_module;
     info.name = m_name;
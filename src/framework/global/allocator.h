@@ -22,9 +22,11 @@
 #ifndef MU_GLOBAL_ALLOCATOR_H
 #define MU_GLOBAL_ALLOCATOR_H
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <list>
+#include <mutex>
 #include <string>
 
 namespace mu {
@@ -113,7 +115,8 @@ public:
     #endif
     }
 
-    static int used;
+    //! NOTE Counts the engraving projects, they may be made and deleted on different threads
+    static std::atomic<int> used;
 
 private:
     struct Chunk {
@@ -139,6 +142,9 @@ private:
     const char* m_name = nullptr;
     size_t m_chunkSize = 0;
     destroyer_t m_dtor = nullptr;
+
+    //! NOTE The pool of the class is shared by all the threads (ex. scores loaded concurrently), guarded by m_mutex
+    mutable std::mutex m_mutex;
     Chunk* m_free = nullptr;
     std::vector<Block> m_blocks;
 
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_GLOBAL_ORDEREDTASKPOOL_H
+#define MU_GLOBAL_ORDEREDTASKPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime.h"
+
+namespace mu {
+//! NOTE Runs the tasks on a bounded pool of threads and passes the results
+//! to the calling thread in the order the tasks were added.
+//! At most maxPending tasks are queued or running at the same time,
+//! add() waits (passing the ready results) when the limit is reached, so the memory stays bounded.
+//! With one thread the tasks are run on the calling thread.
+template<typename Result>
+class OrderedTaskPool
+{
+public:
+    using Task = std::function<Result()>;
+    using OnResult = std::function<void (size_t index, Result&& result)>;
+
+    OrderedTaskPool(size_t threadCount, const OnResult& onResult, size_t maxPending = 0, const std::string& name = "task_pool")
+        : m_onResult(onResult)
+    {
+        if (threadCount <= 1) {
+            return;
+        }
+
+        m_maxPending = maxPending > 0 ? maxPending : threadCount * 2;
+
+        m_threads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            m_threads.emplace_back([this, name, i]() {
+                runtime::setThreadName(name + "_" + std::to_string(i));
+                run();
+            });
+        }
+    }
+
+    ~OrderedTaskPool()
+    {
+        finish();
+    }
+
+    void add(const Task& task)
+    {
+        size_t index = m_added++;
+
+        if (m_threads.empty()) {
+            m_onResult(index, task());
+            m_delivered++;
+            return;
+        }
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_tasks.push_back({ index, task });
+        }
+        m_taskAdded.notify_one();
+
+        deliver(m_maxPending);
+    }
+
+    //! NOTE Waits for all tasks and passes the remaining results
+    void finish()
+    {
+        if (m_threads.empty()) {
+            return;
+        }
+
+        deliver(1);
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopped = true;
+        }
+        m_taskAdded.notify_all();
+
+        for (std::thread& th : m_threads) {
+            th.join();
+        }
+        m_threads.clear();
+    }
+
+private:
+    struct QueuedTask {
+        size_t index = 0;
+        Task task;
+    };
+
+    //! NOTE Passes the ready results in order, while the count of pending tasks is not less than limit
+    void deliver(size_t limit)
+    {
+        while (true) {
+            std::optional<Result> result;
+            {
+                std::unique_lock lock(m_mutex);
+                m_resultAdded.wait(lock, [this, limit]() {
+                    return m_added - m_delivered < limit || m_results.count(m_delivered) > 0;
+                });
+
+                auto it = m_results.find(m_delivered);
+                if (it == m_results.end()) {
+                    return;
+                }
+
+                result.emplace(std::move(it->second));
+                m_results.erase(it);
+            }
+
+            m_onResult(m_delivered, std::move(*result));
+            m_delivered++;
+        }
+    }
+
+    void run()
+    {
+        while (true) {
+            QueuedTask task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_taskAdded.wait(lock, [this]() {
+                    return m_stopped || !m_tasks.empty();
+                });
+
+                if (m_tasks.empty()) {
+                    return;
+                }
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            Result result = task.task();
+
+            {
+                std::lock_guard lock(m_mutex);
+                m_results.emplace(task.index, std::move(result));
+            }
+            m_resultAdded.notify_one();
+        }
+    }
+
+    OnResult m_onResult;
+    size_t m_maxPending = 0;
+
+    //! NOTE Changed only on the calling thread
+    size_t m_added = 0;
+    size_t m_delivered = 0;
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_taskAdded;
+    std::condition_variable m_resultAdded;
+    std::deque<QueuedTask> m_tasks;
+    std::map<size_t, Result> m_results;
+    bool m_stopped = false;
+};
+}
+
+#endif // MU_GLOBAL_ORDEREDTASKPOOL_H
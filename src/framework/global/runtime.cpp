@@ -22,6 +22,16 @@
 
 #include "runtime.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <cstdio>
+#include <unistd.h>
+#endif
+
 static thread_local std::string s_threadName;
 
 void mu::runtime::setThreadName(const std::string& name)
@@ -37,3 +47,39 @@ const std::string& mu::runtime::threadName()
     }
     return s_threadName;
 }
+
+size_t mu::runtime::residentMemorySize()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<size_t>(counters.WorkingSetSize);
+    }
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return static_cast<size_t>(info.resident_size);
+    }
+    return 0;
+#elif defined(__linux__)
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+
+    long pages = 0;
+    long residentPages = 0;
+    int count = std::fscanf(file, "%ld %ld", &pages, &residentPages);
+    std::fclose(file);
+
+    if (count != 2) {
+        return 0;
+    }
+
+    return static_cast<size_t>(residentPages) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
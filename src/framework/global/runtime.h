@@ -50,6 +50,9 @@ inline std::string toString(const std::thread::id& id)
 
 void setThreadName(const std::string& name);
 const std::string& threadName();
+
+//! NOTE Resident memory of the current process in bytes, 0 if unknown on this platform
+size_t residentMemorySize();
 }
 
 #endif // MU_FRAMEWORK_RUNTIME_H
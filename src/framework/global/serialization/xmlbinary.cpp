@@ -0,0 +1,310 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "xmlbinary.h"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "thirdparty/tinyxml/tinyxml2.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace tinyxml2;
+
+static const char SIGNATURE[] = { 'M', 'S', 'B', 'X' };
+static constexpr size_t SIGNATURE_SIZE = sizeof(SIGNATURE);
+static constexpr uint8_t FORMAT_VERSION = 1;
+
+enum NodeTag : uint8_t {
+    EndOfChildren = 0,
+    Element,
+    Text,
+    CData,
+    Comment,
+    Declaration,
+    Unknown
+};
+
+namespace {
+class Encoder
+{
+public:
+    ByteArray encode(const XMLDocument& doc)
+    {
+        writeChildren(&doc);
+
+        ByteArray result;
+        result.reserve(m_body.size() + m_tableSize + 16);
+        result.push_back(reinterpret_cast<const uint8_t*>(SIGNATURE), SIGNATURE_SIZE);
+        result.push_back(FORMAT_VERSION);
+
+        ByteArray table;
+        table.reserve(m_tableSize);
+        writeVarInt(table, m_strings.size());
+        for (const std::string_view& s : m_strings) {
+            writeVarInt(table, s.size());
+            table.push_back(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+        }
+
+        result.push_back(table);
+        result.push_back(m_body);
+        return result;
+    }
+
+private:
+    static void writeVarInt(ByteArray& out, size_t val)
+    {
+        while (val >= 0x80) {
+            out.push_back(static_cast<uint8_t>(val | 0x80));
+            val >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(val));
+    }
+
+    void writeString(const char* str)
+    {
+        std::string_view s(str ? str : "");
+        auto it = m_index.find(s);
+        if (it != m_index.end()) {
+            writeVarInt(m_body, it->second);
+            return;
+        }
+
+        size_t idx = m_strings.size();
+        m_strings.push_back(s);
+        m_index.emplace(s, idx);
+        m_tableSize += s.size() + 2;
+        writeVarInt(m_body, idx);
+    }
+
+    void writeChildren(const XMLNode* parent)
+    {
+        for (const XMLNode* n = parent->FirstChild(); n; n = n->NextSibling()) {
+            if (const XMLElement* e = n->ToElement()) {
+                m_body.push_back(NodeTag::Element);
+                writeString(e->Name());
+
+                size_t attrCount = 0;
+                for (const XMLAttribute* a = e->FirstAttribute(); a; a = a->Next()) {
+                    ++attrCount;
+                }
+
+                writeVarInt(m_body, attrCount);
+                for (const XMLAttribute* a = e->FirstAttribute(); a; a = a->Next()) {
+                    writeString(a->Name());
+                    writeString(a->Value());
+                }
+
+                writeChildren(e);
+                m_body.push_back(NodeTag::EndOfChildren);
+            } else if (const XMLText* t = n->ToText()) {
+                m_body.push_back(t->CData() ? NodeTag::CData : NodeTag::Text);
+                writeString(t->Value());
+            } else if (n->ToComment()) {
+                m_body.push_back(NodeTag::Comment);
+                writeString(n->Value());
+            } else if (n->ToDeclaration()) {
+                m_body.push_back(NodeTag::Declaration);
+                writeString(n->Value());
+            } else if (n->ToUnknown()) {
+                m_body.push_back(NodeTag::Unknown);
+                writeString(n->Value());
+            }
+        }
+    }
+
+    //! NOTE Views point into the source document, which outlives the encoder
+    std::vector<std::string_view> m_strings;
+    std::unordered_map<std::string_view, size_t> m_index;
+    size_t m_tableSize = 0;
+    ByteArray m_body;
+};
+
+class Decoder
+{
+public:
+    Decoder(const ByteArray& data)
+        : m_data(data.constData()), m_end(data.constData() + data.size())
+    {
+        m_pos = m_data + SIGNATURE_SIZE + 1;
+    }
+
+    bool decode(XMLDocument* doc)
+    {
+        size_t count = 0;
+        if (!readVarInt(count)) {
+            return false;
+        }
+
+        m_strings.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            size_t len = 0;
+            if (!readVarInt(len) || static_cast<size_t>(m_end - m_pos) < len) {
+                return false;
+            }
+            m_strings.emplace_back(reinterpret_cast<const char*>(m_pos), len);
+            m_pos += len;
+        }
+
+        std::vector<XMLNode*> parents = { doc };
+        while (m_pos < m_end) {
+            uint8_t tag = *m_pos++;
+            if (tag == NodeTag::EndOfChildren) {
+                parents.pop_back();
+                if (parents.empty()) {
+                    return false;
+                }
+                continue;
+            }
+
+            const char* value = nullptr;
+            if (!readString(value)) {
+                return false;
+            }
+
+            XMLNode* node = nullptr;
+            switch (tag) {
+            case NodeTag::Element: {
+                XMLElement* e = doc->NewElement(value);
+                size_t attrCount = 0;
+                if (!readVarInt(attrCount)) {
+                    return false;
+                }
+
+                for (size_t i = 0; i < attrCount; ++i) {
+                    const char* name = nullptr;
+                    const char* val = nullptr;
+                    if (!readString(name) || !readString(val)) {
+                        return false;
+                    }
+                    e->SetAttribute(name, val);
+                }
+
+                parents.back()->InsertEndChild(e);
+                parents.push_back(e);
+                continue;
+            }
+            case NodeTag::Text:
+                node = doc->NewText(value);
+                break;
+            case NodeTag::CData: {
+                XMLText* t = doc->NewText(value);
+                t->SetCData(true);
+                node = t;
+            } break;
+            case NodeTag::Comment:
+                node = doc->NewComment(value);
+                break;
+            case NodeTag::Declaration:
+                node = doc->NewDeclaration(value);
+                break;
+            case NodeTag::Unknown:
+                node = doc->NewUnknown(value);
+                break;
+            default:
+                return false;
+            }
+
+            parents.back()->InsertEndChild(node);
+        }
+
+        return parents.size() == 1;
+    }
+
+private:
+    bool readVarInt(size_t& val)
+    {
+        val = 0;
+        int shift = 0;
+        while (m_pos < m_end && shift < 64) {
+            uint8_t b = *m_pos++;
+            val |= static_cast<size_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) {
+                return true;
+            }
+            shift += 7;
+        }
+        return false;
+    }
+
+    bool readString(const char*& str)
+    {
+        size_t idx = 0;
+        if (!readVarInt(idx) || idx >= m_strings.size()) {
+            return false;
+        }
+        str = m_strings.at(idx).c_str();
+        return true;
+    }
+
+    const uint8_t* m_data = nullptr;
+    const uint8_t* m_end = nullptr;
+    const uint8_t* m_pos = nullptr;
+    std::vector<std::string> m_strings;
+};
+}
+
+bool XmlBinary::isBinary(const ByteArray& data)
+{
+    return data.size() > SIGNATURE_SIZE
+           && std::memcmp(data.constData(), SIGNATURE, SIGNATURE_SIZE) == 0
+           && data.at(SIGNATURE_SIZE) == FORMAT_VERSION;
+}
+
+ByteArray XmlBinary::fromXml(const ByteArray& xml)
+{
+    XMLDocument doc;
+    XMLError err = doc.Parse(xml.constChar(), xml.size());
+    if (err != XML_SUCCESS) {
+        LOGE() << "failed parse xml, err: " << doc.ErrorStr();
+        return ByteArray();
+    }
+
+    Encoder encoder;
+    return encoder.encode(doc);
+}
+
+bool XmlBinary::toDocument(const ByteArray& data, XMLDocument* doc)
+{
+    IF_ASSERT_FAILED(doc) {
+        return false;
+    }
+
+    doc->Clear();
+
+    if (!isBinary(data)) {
+        return false;
+    }
+
+    Decoder decoder(data);
+    if (!decoder.decode(doc)) {
+        LOGE() << "corrupted binary xml data";
+        doc->Clear();
+        return false;
+    }
+
+    return true;
+}
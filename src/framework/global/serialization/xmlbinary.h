@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_GLOBAL_XMLBINARY_H
+#define MU_GLOBAL_XMLBINARY_H
+
+#include "types/bytearray.h"
+
+namespace tinyxml2 {
+class XMLDocument;
+}
+
+namespace mu {
+//! NOTE Compact binary representation of an XML document.
+//! All names, attribute values and texts are interned into a single string table,
+//! followed by a pre-order stream of nodes that reference the table by index.
+//! Reading it back skips the XML tokenization and entity decoding entirely,
+//! so it is used for internal snapshots (for example alongside autosaves), never for user files.
+//! XmlStreamReader recognizes this format by its signature and reads it transparently.
+class XmlBinary
+{
+public:
+
+    static bool isBinary(const ByteArray& data);
+
+    //! NOTE Returns an empty array if the given data is not a well-formed XML
+    static ByteArray fromXml(const ByteArray& xml);
+
+    static bool toDocument(const ByteArray& data, tinyxml2::XMLDocument* doc);
+};
+}
+
+#endif // MU_GLOBAL_XMLBINARY_H
@@ -25,6 +25,8 @@
 
 #include "thirdparty/tinyxml/tinyxml2.h"
 
+#include "xmlbinary.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -74,7 +76,11 @@ XmlStreamReader::~XmlStreamReader()
 void XmlStreamReader::setData(const ByteArray& data)
 {
     m_xml->doc.Clear();
-    m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data.constData()), data.size());
+    if (XmlBinary::isBinary(data)) {
+        m_xml->err = XmlBinary::toDocument(data, &m_xml->doc) ? XML_SUCCESS : XML_ERROR_PARSING;
+    } else {
+        m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data.constData()), data.size());
+    }
     m_token = m_xml->err == XML_SUCCESS ? TokenType::NoToken : TokenType::Invalid;
     m_xml->customErr.clear();
 
@@ -428,8 +434,7 @@ XmlStreamReader::Error XmlStreamReader::error() const
         return CustomError;
     }
 
-    XMLError err = m_xml->doc.ErrorID();
-    if (err == XML_SUCCESS) {
+    if (m_xml->err == XML_SUCCESS) {
         return NoError;
     }
 
@@ -446,6 +451,11 @@ String XmlStreamReader::errorString() const
     if (!m_xml->customErr.empty()) {
         return m_xml->customErr;
     }
+
+    if (m_xml->err != XML_SUCCESS && m_xml->doc.ErrorID() == XML_SUCCESS) {
+        return u"corrupted binary xml data";
+    }
+
     return String::fromUtf8(m_xml->doc.ErrorStr());
 }
 
@@ -21,6 +21,8 @@
  */
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "types/string.h"
 
 #ifdef CUSTOM_ALLOCATOR_DISABLED
@@ -80,6 +82,15 @@ DECLARE_ITEM(3)
 DECLARE_ITEM(8)
 DECLARE_ITEM(13)
 DECLARE_ITEM(131)
+
+class PooledItem : public ItemBase
+{
+    OBJECT_ALLOCATOR(test, PooledItem)
+public:
+    PooledItem(uint8_t n)
+        : ItemBase(n) {}
+    uint8_t data[24];
+};
 }
 
 class Global_AllocatorTests : public ::testing::Test
@@ -202,3 +213,36 @@ TEST_F(Global_AllocatorTests, Many_NewCleanup)
     EXPECT_EQ(info.totalChunks, 12); // DEFAULT_BLOCK_SIZE * 3
     EXPECT_EQ(info.freeChunks, 12);
 }
+
+TEST_F(Global_AllocatorTests, Pool_ConcurrentNewDelete)
+{
+    //! NOTE Like scores loaded by the parallel conversion jobs
+    constexpr size_t THREAD_COUNT = 4;
+    constexpr size_t ITEM_COUNT = 20000;
+
+    //! DO Create and delete Items of the same class on several threads
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([]() {
+            std::vector<ItemBase*> items;
+            for (size_t i = 0; i < ITEM_COUNT; ++i) {
+                items.push_back(new PooledItem(static_cast<uint8_t>(i)));
+            }
+
+            for (ItemBase* item : items) {
+                EXPECT_TRUE(item->alive());
+                delete item;
+            }
+        });
+    }
+
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    //! CHECK All the chunks went back to the pool
+    ObjectAllocator::Info info = PooledItem::allocator().stateInfo();
+    EXPECT_EQ(info.totalAllocatedCount, THREAD_COUNT * ITEM_COUNT);
+    EXPECT_EQ(info.totalFreeCount, THREAD_COUNT * ITEM_COUNT);
+    EXPECT_EQ(info.freeChunks, info.totalChunks);
+}
@@ -0,0 +1,196 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "async/channel.h"
+#include "async/processevents.h"
+
+#include "log.h"
+
+using namespace mu;
+
+using Clock = std::chrono::steady_clock;
+
+static int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+//! NOTE Subscribes to the channel on its own thread and processes its queue until all the values are received
+class ChannelReceiverThread
+{
+public:
+    ChannelReceiverThread(async::Channel<int, int64_t> channel, size_t expectedCount)
+        : m_channel(channel), m_expectedCount(expectedCount)
+    {
+        m_values.reserve(expectedCount);
+        m_latenciesNs.reserve(expectedCount);
+
+        m_thread = std::thread([this]() {
+            m_channel.onReceive(nullptr, [this](int value, int64_t sentNs) {
+                m_latenciesNs.push_back(nowNs() - sentNs);
+                m_values.push_back(value);
+            });
+
+            m_isSubscribed = true;
+
+            while (m_values.size() < m_expectedCount) {
+                async::processEvents();
+                std::this_thread::yield();
+            }
+        });
+
+        while (!m_isSubscribed) {
+            std::this_thread::yield();
+        }
+    }
+
+    void join()
+    {
+        m_thread.join();
+    }
+
+    const std::vector<int>& values() const
+    {
+        return m_values;
+    }
+
+    std::vector<int64_t> latenciesNs() const
+    {
+        return m_latenciesNs;
+    }
+
+private:
+    async::Channel<int, int64_t> m_channel;
+    size_t m_expectedCount = 0;
+    std::atomic<bool> m_isSubscribed = false;
+    std::vector<int> m_values;
+    std::vector<int64_t> m_latenciesNs;
+    std::thread m_thread;
+};
+
+TEST(Global_ChannelTests, SendAcrossThreads_KeepsOrder)
+{
+    //! NOTE Much more than fits the receiver's queue, so some of the values go through the overflow
+    constexpr int COUNT = 20000;
+
+    async::Channel<int, int64_t> channel;
+    ChannelReceiverThread receiver(channel, COUNT);
+
+    for (int i = 0; i < COUNT; ++i) {
+        channel.send(i, nowNs());
+    }
+
+    receiver.join();
+
+    ASSERT_EQ(receiver.values().size(), static_cast<size_t>(COUNT));
+    for (int i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(receiver.values()[i], i);
+    }
+}
+
+TEST(Global_ChannelTests, Benchmark_SendAcrossThreads)
+{
+    constexpr int COUNT = 200000;
+
+    async::Channel<int, int64_t> channel;
+    ChannelReceiverThread receiver(channel, COUNT);
+
+    auto begin = Clock::now();
+
+    for (int i = 0; i < COUNT; ++i) {
+        channel.send(i, nowNs());
+
+        //! NOTE Let the receiver keep up, so the latency isn't dominated by the queue length
+        if (i % 256 == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    receiver.join();
+
+    auto end = Clock::now();
+
+    std::vector<int64_t> latencies = receiver.latenciesNs();
+    ASSERT_EQ(latencies.size(), static_cast<size_t>(COUNT));
+    std::sort(latencies.begin(), latencies.end());
+
+    int64_t totalUs = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+
+    LOGI() << "sends: " << COUNT
+           << ", total: " << totalUs << " us"
+           << ", throughput: " << (totalUs > 0 ? COUNT * 1000000LL / totalUs : 0) << " sends/s"
+           << ", latency median: " << latencies[latencies.size() / 2] / 1000 << " us"
+           << ", p99: " << latencies[latencies.size() * 99 / 100] / 1000 << " us"
+           << ", max: " << latencies.back() / 1000 << " us";
+
+    EXPECT_EQ(receiver.values().back(), COUNT - 1);
+}
+
+TEST(Global_ChannelTests, ResetOnReceive_WithQueuedCalls)
+{
+    constexpr int COUNT = 100;
+
+    std::atomic<bool> isSubscribed = false;
+    std::atomic<bool> isReset = false;
+    std::atomic<int> receivedCount = 0;
+
+    async::Channel<int, int64_t> channel;
+
+    std::thread receiverThread([&]() {
+        channel.onReceive(nullptr, [&](int, int64_t) {
+            ++receivedCount;
+        });
+
+        isSubscribed = true;
+
+        while (!isReset) {
+            std::this_thread::yield();
+        }
+
+        //! NOTE The queued calls were unlinked from the channel by the reset, they are just dropped here
+        async::processEvents();
+    });
+
+    while (!isSubscribed) {
+        std::this_thread::yield();
+    }
+
+    for (int i = 0; i < COUNT; ++i) {
+        channel.send(i, nowNs());
+    }
+
+    channel.resetOnReceive(nullptr);
+    isReset = true;
+
+    receiverThread.join();
+
+    EXPECT_EQ(receivedCount, 0);
+    EXPECT_FALSE(channel.isConnected());
+}
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "orderedtaskpool.h"
+
+using namespace mu;
+
+//! NOTE Simulates the rasterization of a page: CPU-bound, the result depends only on the input
+static std::vector<uint8_t> rasterize(size_t page, size_t size)
+{
+    std::vector<uint8_t> pixels(size);
+    uint32_t v = static_cast<uint32_t>(page) * 2654435761u + 1;
+    for (size_t i = 0; i < size; ++i) {
+        v ^= v << 13;
+        v ^= v >> 17;
+        v ^= v << 5;
+        pixels[i] = static_cast<uint8_t>(v);
+    }
+    return pixels;
+}
+
+static std::vector<std::vector<uint8_t> > rasterizePages(size_t threadCount, size_t pageCount, size_t pageSize)
+{
+    std::vector<std::vector<uint8_t> > pages;
+
+    OrderedTaskPool<std::vector<uint8_t> > pool(threadCount, [&pages](size_t index, std::vector<uint8_t>&& pixels) {
+        EXPECT_EQ(index, pages.size());
+        pages.push_back(std::move(pixels));
+    });
+
+    for (size_t page = 0; page < pageCount; ++page) {
+        pool.add([page, pageSize]() {
+            return rasterize(page, pageSize);
+        });
+    }
+
+    pool.finish();
+
+    return pages;
+}
+
+TEST(Global_OrderedTaskPoolTests, SameResultsAsSerial)
+{
+    //! [GIVEN] Pages rasterized on the calling thread
+    std::vector<std::vector<uint8_t> > serial = rasterizePages(1, 40, 10000);
+
+    //! [WHEN] Rasterized on a pool
+    std::vector<std::vector<uint8_t> > parallel = rasterizePages(4, 40, 10000);
+
+    //! [THEN] The results are the same and in the same order
+    EXPECT_TRUE(serial == parallel);
+}
+
+TEST(Global_OrderedTaskPoolTests, PendingTasksAreBounded)
+{
+    //! [GIVEN] A pool with at most 3 pending tasks
+    constexpr size_t MAX_PENDING = 3;
+
+    std::atomic<size_t> started = 0;
+    size_t delivered = 0;
+    size_t maxInFlight = 0;
+
+    OrderedTaskPool<size_t> pool(2, [&](size_t index, size_t&& result) {
+        EXPECT_EQ(index, result);
+        EXPECT_EQ(index, delivered);
+        delivered++;
+    }, MAX_PENDING);
+
+    //! [WHEN] Many tasks are added
+    for (size_t i = 0; i < 50; ++i) {
+        pool.add([i, &started]() {
+            started++;
+            std::this_thread::sleep_for(std::chrono::microseconds(((i * 7) % 5) * 100));
+            return i;
+        });
+
+        maxInFlight = std::max(maxInFlight, started.load() - delivered);
+    }
+
+    pool.finish();
+
+    //! [THEN] All results are delivered in order, never more than the limit in flight
+    EXPECT_EQ(delivered, 50);
+    EXPECT_LE(maxInFlight, MAX_PENDING);
+}
@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "io/buffer.h"
+#include "serialization/xmlbinary.h"
+#include "serialization/xmlstreamreader.h"
+#include "serialization/xmlstreamwriter.h"
+
+using namespace mu;
+using namespace mu::io;
+
+class Global_Ser_XmlBinary : public ::testing::Test
+{
+public:
+
+    static ByteArray writeXml()
+    {
+        Buffer buf;
+        buf.open(IODevice::WriteOnly);
+
+        XmlStreamWriter xml(&buf);
+        xml.startDocument();
+        xml.startElement("museScore", { { "version", "4.00" } });
+        xml.element("programVersion", String(u"4.0.0"));
+        xml.comment(u"some comment");
+        xml.startElement("Score");
+        xml.startElement("Staff", { { "id", 1 } });
+        for (int i = 0; i < 10; ++i) {
+            xml.startElement("Measure");
+            xml.startElement("Chord");
+            xml.element("durationType", String(u"quarter"));
+            xml.startElement("Note");
+            xml.element("pitch", 60 + i);
+            xml.element("tpc", 14);
+            xml.endElement();
+            xml.endElement();
+            xml.element("Text", String(u"a < b & \"c\" 中"));
+            xml.element("offset", { { "x", 1.5 }, { "y", -2.25 } });
+            xml.endElement();
+        }
+        xml.endElement();
+        xml.endElement();
+        xml.endElement();
+        xml.flush();
+
+        return buf.data();
+    }
+
+    struct Token {
+        XmlStreamReader::TokenType type = XmlStreamReader::NoToken;
+        std::string name;
+        String text;
+        std::vector<std::pair<std::string, String> > attrs;
+
+        bool operator==(const Token& t) const
+        {
+            return type == t.type && name == t.name && text == t.text && attrs == t.attrs;
+        }
+    };
+
+    static std::string toStdString(const AsciiStringView& s)
+    {
+        return s.empty() ? std::string() : std::string(s.ascii(), s.size());
+    }
+
+    static std::vector<Token> readTokens(const ByteArray& data)
+    {
+        std::vector<Token> tokens;
+        XmlStreamReader xml(data);
+        while (xml.readNext() != XmlStreamReader::Invalid && !xml.atEnd()) {
+            Token t;
+            t.type = xml.tokenType();
+            t.name = toStdString(xml.name());
+            t.text = xml.text();
+            for (const XmlStreamReader::Attribute& a : xml.attributes()) {
+                t.attrs.push_back({ toStdString(a.name), a.value });
+            }
+            tokens.push_back(t);
+        }
+        return tokens;
+    }
+};
+
+TEST_F(Global_Ser_XmlBinary, RoundTrip)
+{
+    //! GIVEN XML written by XmlStreamWriter
+    ByteArray xml = writeXml();
+    EXPECT_FALSE(XmlBinary::isBinary(xml));
+
+    //! WHEN it is converted to the binary format
+    ByteArray bin = XmlBinary::fromXml(xml);
+
+    //! THEN it is recognized as binary and is smaller than the source
+    EXPECT_TRUE(XmlBinary::isBinary(bin));
+    EXPECT_LT(bin.size(), xml.size());
+
+    //! THEN the reader produces exactly the same token stream for both
+    std::vector<Token> xmlTokens = readTokens(xml);
+    std::vector<Token> binTokens = readTokens(bin);
+
+    EXPECT_FALSE(xmlTokens.empty());
+    ASSERT_EQ(xmlTokens.size(), binTokens.size());
+    for (size_t i = 0; i < xmlTokens.size(); ++i) {
+        EXPECT_TRUE(xmlTokens.at(i) == binTokens.at(i)) << "token: " << i;
+    }
+}
+
+TEST_F(Global_Ser_XmlBinary, ReadValues)
+{
+    //! GIVEN binary data
+    ByteArray bin = XmlBinary::fromXml(writeXml());
+
+    //! WHEN read it
+    XmlStreamReader xml(bin);
+
+    //! THEN typed access works as for the text format
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "museScore");
+    EXPECT_EQ(xml.attribute("version"), u"4.00");
+
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "programVersion");
+    EXPECT_EQ(xml.readText(), u"4.0.0");
+
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Score");
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.intAttribute("id"), 1);
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "Measure");
+    ASSERT_TRUE(xml.readNextStartElement());
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.name(), "durationType");
+    xml.skipCurrentElement();
+    ASSERT_TRUE(xml.readNextStartElement());
+    ASSERT_TRUE(xml.readNextStartElement());
+    EXPECT_EQ(xml.readInt(), 60);
+    EXPECT_FALSE(xml.isError());
+}
+
+TEST_F(Global_Ser_XmlBinary, Corrupted)
+{
+    //! GIVEN truncated binary data
+    ByteArray bin = XmlBinary::fromXml(writeXml());
+    ByteArray truncated = bin.left(bin.size() / 2);
+
+    //! WHEN read it
+    XmlStreamReader xml(truncated);
+
+    //! THEN it is reported as an error, not a crash
+    EXPECT_FALSE(xml.readNextStartElement());
+    EXPECT_TRUE(xml.isError());
+}
+
+TEST_F(Global_Ser_XmlBinary, NotXml)
+{
+    EXPECT_TRUE(XmlBinary::fromXml(ByteArray("<a><b></a>")).empty());
+}
@@ -15,7 +15,9 @@ AbstractInvoker::~AbstractInvoker()
     std::lock_guard<std::mutex> lock(m_qInvokersMutex);
     for (QInvoker* qi : m_qInvokers) {
         qi->invalidate();
+        qi->linked = false;
     }
+    m_qInvokers.clear();
 }
 
 void AbstractInvoker::invoke(int type)
@@ -118,10 +120,14 @@ void AbstractInvoker::removeCallBack(int type, Asyncable* receiver)
 
     {
         std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-        for (QInvoker* qi : m_qInvokers) {
+        for (auto qiIt = m_qInvokers.begin(); qiIt != m_qInvokers.end();) {
+            QInvoker* qi = *qiIt;
             if (qi->call.call == c.call) {
                 qi->invalidate();
-                break;
+                qi->linked = false;
+                qiIt = m_qInvokers.erase(qiIt);
+            } else {
+                ++qiIt;
             }
         }
     }
@@ -184,11 +190,19 @@ void AbstractInvoker::disconnectAsync(Asyncable* receiver)
 void AbstractInvoker::addQInvoker(QInvoker* qi)
 {
     std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    m_qInvokers.push_back(qi);
+    qi->pos = m_qInvokers.insert(m_qInvokers.end(), qi);
+    qi->linked = true;
 }
 
 void AbstractInvoker::removeQInvoker(QInvoker* qi)
 {
     std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    m_qInvokers.remove(qi);
+
+    //! NOTE Might be already unlinked by removeCallBack() meanwhile
+    if (!qi->linked) {
+        return;
+    }
+
+    m_qInvokers.erase(qi->pos);
+    qi->linked = false;
 }
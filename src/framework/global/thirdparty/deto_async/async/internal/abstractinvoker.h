@@ -1,6 +1,7 @@
 #ifndef DETO_ASYNC_ABSTRACTINVOKER_H
 #define DETO_ASYNC_ABSTRACTINVOKER_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <list>
@@ -103,33 +104,30 @@ protected:
 
     struct QInvoker
     {
-        std::mutex mutex;
-        AbstractInvoker* invoker = nullptr;
+        std::atomic<AbstractInvoker*> invoker = nullptr;
         int type = -1;
         CallBack call;
         NotifyData data;
+        std::list<QInvoker*>::iterator pos;
+        bool linked = false; //! NOTE Guarded by the invoker's m_qInvokersMutex, tells whether pos is still valid
 
-        QInvoker(AbstractInvoker* i, int t, CallBack c, NotifyData d)
+        QInvoker(AbstractInvoker* i, int t, const CallBack& c, const NotifyData& d)
             : invoker(i), type(t), call(c), data(d)
         {
-            invoker->addQInvoker(this);
+            i->addQInvoker(this);
         }
 
         ~QInvoker()
         {
-            if (invoker) {
-                invoker->removeQInvoker(this);
+            AbstractInvoker* inv = invoker.load(std::memory_order_acquire);
+            if (inv) {
+                inv->removeQInvoker(this);
             }
         }
 
         void invoke()
         {
-            AbstractInvoker* inv = nullptr;
-            {
-                std::lock_guard<std::mutex> lock(mutex);
-                inv = invoker;
-            }
-
+            AbstractInvoker* inv = invoker.load(std::memory_order_acquire);
             if (inv) {
                 inv->invokeCallback(type, call, data);
             }
@@ -137,8 +135,7 @@ protected:
 
         void invalidate()
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            invoker = nullptr;
+            invoker.store(nullptr, std::memory_order_release);
         }
     };
 
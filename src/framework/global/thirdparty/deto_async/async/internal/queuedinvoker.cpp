@@ -2,6 +2,64 @@
 
 using namespace deto::async;
 
+QueuedInvoker::CallQueue::CallQueue()
+{
+    for (size_t i = 0; i < CAPACITY; ++i) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool QueuedInvoker::CallQueue::tryPush(QueuedCall& call)
+{
+    Cell* cell = nullptr;
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        cell = &m_cells[pos % CAPACITY];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->call = std::move(call);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool QueuedInvoker::CallQueue::process()
+{
+    const size_t end = m_enqueuePos.load(std::memory_order_acquire);
+
+    while (m_dequeuePos != end) {
+        Cell& cell = m_cells[m_dequeuePos % CAPACITY];
+
+        //! NOTE The cell is reserved by a producer, but the call isn't written yet
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            return false;
+        }
+
+        QueuedCall call = std::move(cell.call);
+        cell.sequence.store(m_dequeuePos + CAPACITY, std::memory_order_release);
+        ++m_dequeuePos;
+
+        if (call) {
+            call();
+        }
+    }
+
+    return m_enqueuePos.load(std::memory_order_acquire) == end;
+}
+
 QueuedInvoker* QueuedInvoker::instance()
 {
     static QueuedInvoker i;
@@ -10,28 +68,96 @@ QueuedInvoker* QueuedInvoker::instance()
 
 void QueuedInvoker::invoke(const std::thread::id& th, const Functor& f, bool isAlwaysQueued)
 {
-    if (m_onMainThreadInvoke) {
-        if (th == m_mainThreadID) {
-            m_onMainThreadInvoke(f, isAlwaysQueued);
+    //! NOTE The main thread has its own event loop and doesn't process this queue
+    if (m_onMainThreadInvoke && th == m_mainThreadID) {
+        m_onMainThreadInvoke(f, isAlwaysQueued);
+        return;
+    }
+
+    enqueue(th, QueuedCall(f));
+}
+
+void QueuedInvoker::enqueue(const std::thread::id& th, QueuedCall&& call)
+{
+    ThreadQueue* tq = threadQueue(th, true);
+    if (tq && tq->overflowCount.load(std::memory_order_acquire) == 0) {
+        if (tq->queue->tryPush(call)) {
+            return;
         }
     }
 
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    m_queues[th].push(f);
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    m_overflow[th].push(std::move(call));
+
+    if (tq) {
+        tq->overflowCount.fetch_add(1, std::memory_order_release);
+    }
+}
+
+QueuedInvoker::ThreadQueue* QueuedInvoker::threadQueue(const std::thread::id& th, bool create)
+{
+    size_t count = m_threadQueuesCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        if (m_threadQueues[i].threadID == th) {
+            return &m_threadQueues[i];
+        }
+    }
+
+    if (!create) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_threadQueuesMutex);
+
+    //! NOTE Might be added by another producer meanwhile
+    count = m_threadQueuesCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        if (m_threadQueues[i].threadID == th) {
+            return &m_threadQueues[i];
+        }
+    }
+
+    if (count == MAX_THREADS) {
+        return nullptr;
+    }
+
+    ThreadQueue& tq = m_threadQueues[count];
+    tq.threadID = th;
+    tq.queue = std::make_unique<CallQueue>();
+    m_threadQueuesCount.store(count + 1, std::memory_order_release);
+
+    return &tq;
 }
 
 void QueuedInvoker::processEvents()
 {
-    Queue q;
+    std::thread::id th = std::this_thread::get_id();
+
+    ThreadQueue* tq = threadQueue(th, true);
+    if (tq) {
+        bool isQueueEmpty = tq->queue->process();
+
+        //! NOTE The overflow calls were queued after the ones left in the queue
+        if (!isQueueEmpty || tq->overflowCount.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+
+    std::queue<QueuedCall> q;
     {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
-        auto n = m_queues.extract(std::this_thread::get_id());
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        auto n = m_overflow.extract(th);
         if (!n.empty()) {
-            q = n.mapped();
+            q = std::move(n.mapped());
+        }
+
+        if (tq) {
+            tq->overflowCount.store(0, std::memory_order_release);
         }
     }
+
     while (!q.empty()) {
-        const auto& f = q.front();
+        QueuedCall& f = q.front();
         if (f) {
             f();
         }
@@ -1,14 +1,133 @@
 #ifndef DETO_ASYNC_QUEUEDINVOKER_H
 #define DETO_ASYNC_QUEUEDINVOKER_H
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <new>
 #include <queue>
 #include <map>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 
 namespace deto {
 namespace async {
+//! NOTE Move-only void() callable, small callables (a few captured pointers)
+//! are stored in place, so queuing them doesn't allocate
+class QueuedCall
+{
+public:
+    QueuedCall() = default;
+
+    template<typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, QueuedCall>::value> >
+    QueuedCall(F&& f)
+    {
+        using Func = std::decay_t<F>;
+        if constexpr (isInplace<Func>()) {
+            new (m_storage) Func(std::forward<F>(f));
+            m_ops = &InplaceOps<Func>::ops;
+        } else {
+            new (m_storage) Func*(new Func(std::forward<F>(f)));
+            m_ops = &HeapOps<Func>::ops;
+        }
+    }
+
+    QueuedCall(QueuedCall&& other) noexcept
+    {
+        moveFrom(other);
+    }
+
+    QueuedCall& operator=(QueuedCall&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    QueuedCall(const QueuedCall&) = delete;
+    QueuedCall& operator=(const QueuedCall&) = delete;
+
+    ~QueuedCall()
+    {
+        reset();
+    }
+
+    explicit operator bool() const
+    {
+        return m_ops != nullptr;
+    }
+
+    void operator()()
+    {
+        m_ops->call(m_storage);
+    }
+
+    void reset()
+    {
+        if (m_ops) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    static constexpr size_t BUFFER_SIZE = 6 * sizeof(void*);
+
+    struct Ops {
+        void (* call)(void* storage);
+        void (* move)(void* from, void* to);
+        void (* destroy)(void* storage);
+    };
+
+    template<typename F>
+    static constexpr bool isInplace()
+    {
+        return sizeof(F) <= BUFFER_SIZE
+               && alignof(F) <= alignof(std::max_align_t)
+               && std::is_nothrow_move_constructible<F>::value;
+    }
+
+    template<typename F>
+    struct InplaceOps {
+        static void call(void* storage) { (*static_cast<F*>(storage))(); }
+        static void move(void* from, void* to)
+        {
+            F* f = static_cast<F*>(from);
+            new (to) F(std::move(*f));
+            f->~F();
+        }
+
+        static void destroy(void* storage) { static_cast<F*>(storage)->~F(); }
+        static constexpr Ops ops = { &call, &move, &destroy };
+    };
+
+    template<typename F>
+    struct HeapOps {
+        static void call(void* storage) { (**static_cast<F**>(storage))(); }
+        static void move(void* from, void* to) { new (to) F*(*static_cast<F**>(from)); }
+        static void destroy(void* storage) { delete *static_cast<F**>(storage); }
+        static constexpr Ops ops = { &call, &move, &destroy };
+    };
+
+    void moveFrom(QueuedCall& other)
+    {
+        if (other.m_ops) {
+            other.m_ops->move(other.m_storage, m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[BUFFER_SIZE];
+    const Ops* m_ops = nullptr;
+};
+
 class QueuedInvoker
 {
 public:
@@ -18,6 +137,18 @@ public:
     using Functor = std::function<void ()>;
 
     void invoke(const std::thread::id& th, const Functor& f, bool isAlwaysQueued = false);
+
+    template<typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, Functor>::value> >
+    void invoke(const std::thread::id& th, F&& f, bool isAlwaysQueued = false)
+    {
+        if (m_onMainThreadInvoke && th == m_mainThreadID) {
+            m_onMainThreadInvoke(Functor(std::forward<F>(f)), isAlwaysQueued);
+            return;
+        }
+
+        enqueue(th, QueuedCall(std::forward<F>(f)));
+    }
+
     void processEvents();
     void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
 
@@ -25,10 +156,51 @@ private:
 
     QueuedInvoker() = default;
 
-    using Queue = std::queue<Functor>;
+    //! NOTE Bounded multiple producers / single consumer queue (the consumer is the receiver thread),
+    //! each cell has a sequence number telling whether it's free for the producers or ready for the consumer
+    class CallQueue
+    {
+    public:
+        CallQueue();
+
+        bool tryPush(QueuedCall& call);
+
+        //! NOTE Calls only what was pushed before, returns false if something is left
+        bool process();
+
+    private:
+        static constexpr size_t CAPACITY = 1024;
+
+        struct Cell {
+            std::atomic<size_t> sequence { 0 };
+            QueuedCall call;
+        };
+
+        std::array<Cell, CAPACITY> m_cells;
+        alignas(64) std::atomic<size_t> m_enqueuePos { 0 };
+        alignas(64) size_t m_dequeuePos = 0;
+    };
+
+    struct ThreadQueue {
+        std::thread::id threadID;
+        std::unique_ptr<CallQueue> queue;
+
+        //! NOTE Calls put to the overflow, while there are any the new ones follow them to keep the order
+        std::atomic<size_t> overflowCount { 0 };
+    };
+
+    static constexpr size_t MAX_THREADS = 32;
+
+    void enqueue(const std::thread::id& th, QueuedCall&& call);
+    ThreadQueue* threadQueue(const std::thread::id& th, bool create);
+
+    std::array<ThreadQueue, MAX_THREADS> m_threadQueues;
+    std::atomic<size_t> m_threadQueuesCount { 0 };
+    std::mutex m_threadQueuesMutex;
 
-    std::recursive_mutex m_mutex;
-    std::map<std::thread::id, Queue > m_queues;
+    //! NOTE Used when a thread queue is full or there are too many threads
+    std::mutex m_overflowMutex;
+    std::map<std::thread::id, std::queue<QueuedCall> > m_overflow;
 
     std::function<void(const std::function<void()>&, bool)> m_onMainThreadInvoke;
     std::thread::id m_mainThreadID;
@@ -154,6 +154,9 @@ private:
         calculatePitchCurve(m_expressionCtx.articulations);
 
         calculateExpressionCurve(m_expressionCtx.articulations);
+
+        m_pitchCtx.pitchCurve.intern();
+        m_expressionCtx.expressionCurve.intern();
     }
 
     void calculateActualTimestamp(const ArticulationMap& articulationsApplied)
@@ -26,9 +26,11 @@
 #include <stdint.h>
 #include <math.h>
 #include <algorithm>
+#include <array>
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -118,6 +120,110 @@ struct ValuesCurve : public SharedMap<duration_percentage_t, T>
 
         return (factor + 1.f) / 2.f;
     }
+
+    //! NOTE Replaces the data with an instance shared by all the curves holding the same points.
+    //!      Curves of note events are mostly a few distinct shapes scaled by a few distinct ratios,
+    //!      so interning them lets thousands of events reference one map instead of owning a copy each
+    void intern()
+    {
+        if (!this->m_dataPtr) {
+            return;
+        }
+
+        const Data& data = *this->m_dataPtr;
+        size_t hash = dataHash(data);
+        PoolShard& shard = poolShard(hash);
+
+        std::lock_guard lock(shard.mutex);
+
+        auto range = shard.pool.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (*it->second == data) {
+                this->m_dataPtr = it->second;
+                return;
+            }
+        }
+
+        if (shard.pool.size() >= shard.purgeThreshold) {
+            purgeShard(shard);
+        }
+
+        //! NOTE The pool keeps its own reference to a fresh copy, so the shared instance never has a single owner,
+        //!      and any owner going to modify it detaches first
+        auto shared = std::make_shared<Data>(data);
+        shard.pool.emplace(hash, shared);
+        this->m_dataPtr = std::move(shared);
+    }
+
+    //! NOTE Drops the shared instances no curve references anymore, e.g. after a score is closed.
+    //!      The pool holds strong references, so without it they would stay until a shard grows
+    static void purgePool()
+    {
+        for (PoolShard& shard : poolShards()) {
+            std::lock_guard lock(shard.mutex);
+            purgeShard(shard);
+        }
+    }
+
+    static size_t poolSize()
+    {
+        size_t size = 0;
+        for (PoolShard& shard : poolShards()) {
+            std::lock_guard lock(shard.mutex);
+            size += shard.pool.size();
+        }
+        return size;
+    }
+
+private:
+    using Data = typename SharedMap<duration_percentage_t, T>::Data;
+
+    static constexpr size_t MIN_POOL_PURGE_SIZE = 64;
+    static constexpr size_t POOL_SHARD_COUNT = 16;
+
+    struct PoolShard {
+        std::mutex mutex;
+        std::unordered_multimap<size_t, std::shared_ptr<Data> > pool;
+        size_t purgeThreshold = MIN_POOL_PURGE_SIZE;
+    };
+
+    static size_t dataHash(const Data& data)
+    {
+        size_t hash = data.size();
+        for (const auto& pair : data) {
+            hash ^= std::hash<duration_percentage_t>()(pair.first) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<T>()(pair.second) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        return hash;
+    }
+
+    //! NOTE The pool is split by the hash, so the rendering threads rarely wait for each other
+    static std::array<PoolShard, POOL_SHARD_COUNT>& poolShards()
+    {
+        static std::array<PoolShard, POOL_SHARD_COUNT> shards;
+        return shards;
+    }
+
+    static PoolShard& poolShard(size_t hash)
+    {
+        return poolShards()[hash % POOL_SHARD_COUNT];
+    }
+
+    //! NOTE Must be called with the shard locked
+    static void purgeShard(PoolShard& shard)
+    {
+        for (auto it = shard.pool.begin(); it != shard.pool.end();) {
+            //! NOTE Only the pool holds it, so nobody can get it except through the pool
+            if (it->second.use_count() == 1) {
+                it = shard.pool.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        shard.purgeThreshold = std::max(MIN_POOL_PURGE_SIZE, shard.pool.size() * 2);
+    }
 };
 
 // Pitch
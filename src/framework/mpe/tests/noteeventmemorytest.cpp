@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "mpe/events.h"
+#include "mpe/tests/utils/articulationutils.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::mpe;
+using namespace mu::mpe::tests;
+
+//! NOTE Counts the heap memory that is alive, so the memory of the events is measured rather than estimated.
+//!      Every allocation keeps its size in a header in front of the returned block
+static std::atomic<long long> s_liveBytes = 0;
+static constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+void* operator new(size_t size)
+{
+    void* block = std::malloc(size + HEADER_SIZE);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+
+    *static_cast<size_t*>(block) = size;
+    s_liveBytes += size;
+    return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (!ptr) {
+        return;
+    }
+
+    void* block = static_cast<char*>(ptr) - HEADER_SIZE;
+    s_liveBytes -= *static_cast<size_t*>(block);
+    std::free(block);
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+class Engraving_NoteEventMemoryTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // [GIVEN] Articulation pattern "Accent"
+        ArticulationPatternSegment accentArticulation;
+        accentArticulation.arrangementPattern = createArrangementPattern(HUNDRED_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+        accentArticulation.pitchPattern = createSimplePitchPattern(0 /*increment_pitch_diff*/);
+        accentArticulation.expressionPattern = createSimpleExpressionPattern(dynamicLevelFromType(DynamicType::mf));
+
+        m_scope.emplace(0, accentArticulation);
+    }
+
+    NoteEvent buildNote(timestamp_t timestamp) const
+    {
+        ArticulationMeta accentMeta;
+        accentMeta.type = ArticulationType::Accent;
+        accentMeta.pattern = m_scope;
+        accentMeta.timestamp = timestamp;
+        accentMeta.overallDuration = m_nominalDuration;
+
+        ArticulationMap appliedArticulations = {};
+        appliedArticulations.emplace(ArticulationType::Accent, ArticulationAppliedData(std::move(accentMeta), 0, HUNDRED_PERCENT));
+        appliedArticulations.preCalculateAverageData();
+
+        return NoteEvent(timestamp,
+                         m_nominalDuration,
+                         0 /*voice_idx*/,
+                         pitchLevel(PitchClass::A, 4),
+                         dynamicLevelFromType(DynamicType::mf),
+                         std::move(appliedArticulations));
+    }
+
+    duration_t m_nominalDuration = 500; // msecs
+    ArticulationPattern m_scope;
+};
+
+/**
+ * @brief NoteEventMemoryTest_MemoryPerEvent
+ * @details In this case we're gonna build a thousand of "mezzo forte" notes with the accent applied and measure the heap memory
+ *          each of them keeps alive. Only the first note should pay for the pitch and expression curves, the other ones share them.
+ *          Once the notes are gone, the pool of the shared curves should be emptied by the purge
+ */
+TEST_F(Engraving_NoteEventMemoryTest, MemoryPerEvent)
+{
+    constexpr size_t EVENT_COUNT = 1000;
+
+    // [GIVEN] No curves left in the pool by the other tests
+    PitchCurve::purgePool();
+    ExpressionCurve::purgePool();
+    ASSERT_EQ(PitchCurve::poolSize() + ExpressionCurve::poolSize(), 0);
+
+    std::vector<NoteEvent> events;
+    events.reserve(EVENT_COUNT);
+
+    // [WHEN] The first note being built
+    long long liveBytes = s_liveBytes;
+    events.push_back(buildNote(0));
+    const long long firstEventBytes = s_liveBytes - liveBytes;
+
+    // [WHEN] The other notes being built
+    liveBytes = s_liveBytes;
+    for (size_t i = 1; i < EVENT_COUNT; ++i) {
+        events.push_back(buildNote(static_cast<timestamp_t>(i) * m_nominalDuration));
+    }
+    const long long eventBytes = (s_liveBytes - liveBytes) / static_cast<long long>(EVENT_COUNT - 1);
+
+    // [WHEN] A copy of the expression curve being detached from the shared data
+    ExpressionCurve curve = events.front().expressionCtx().expressionCurve;
+    liveBytes = s_liveBytes;
+    curve.begin()->second += DYNAMIC_LEVEL_STEP;
+    const long long curveBytes = s_liveBytes - liveBytes;
+
+    LOGI() << "first event: " << firstEventBytes << " bytes, next events: " << eventBytes
+           << " bytes each, one owned expression curve: " << curveBytes << " bytes";
+
+    // [THEN] We expect that the notes built after the first one don't own their curves
+    EXPECT_GT(curveBytes, 0);
+    EXPECT_GE(firstEventBytes - eventBytes, curveBytes);
+
+    // [WHEN] The notes are dropped and the pool is purged, like after a score is closed
+    curve = ExpressionCurve();
+    events.clear();
+    PitchCurve::purgePool();
+    ExpressionCurve::purgePool();
+
+    // [THEN] We expect that no curve outlives the notes
+    EXPECT_EQ(PitchCurve::poolSize() + ExpressionCurve::poolSize(), 0);
+}
@@ -422,3 +422,121 @@ TEST_F(Engraving_SingleNoteArticulationsTest, Scoop)
     //        In other words, we'll start to playback a note with pitch offset and then finally land on the note being played
     EXPECT_EQ(event.arrangementCtx().actualTimestamp, m_nominalTimestamp + m_nominalDuration * percentageToFactor(timestampOffset));
 }
+
+/**
+ * @brief SingleNoteArticulationsTest_SharedCurves
+ * @details In this case we're gonna build several notes with the accent articulation applied on the top of them.
+ *          All of them end up with the same pitch and expression curves, so they should reference the same data
+ *          instead of owning a copy each
+ */
+TEST_F(Engraving_SingleNoteArticulationsTest, SharedCurves)
+{
+    // [GIVEN] Articulation pattern "Accent"
+    ArticulationPatternSegment accentArticulation;
+    accentArticulation.arrangementPattern = createArrangementPattern(HUNDRED_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+    accentArticulation.pitchPattern = createSimplePitchPattern(0 /*increment_pitch_diff*/);
+    accentArticulation.expressionPattern = createSimpleExpressionPattern(dynamicLevelFromType(DynamicType::mf));
+
+    ArticulationPattern scope;
+    scope.emplace(0, accentArticulation);
+
+    // [WHEN] Several consecutive "mezzo forte" notes with the accent applied being built
+    std::vector<NoteEvent> events;
+
+    for (int i = 0; i < 4; ++i) {
+        timestamp_t timestamp = m_nominalTimestamp + i * m_nominalDuration;
+
+        ArticulationMeta accentMeta;
+        accentMeta.type = ArticulationType::Accent;
+        accentMeta.pattern = scope;
+        accentMeta.timestamp = timestamp;
+        accentMeta.overallDuration = m_nominalDuration;
+
+        ArticulationMap appliedArticulations = {};
+        appliedArticulations.emplace(ArticulationType::Accent, ArticulationAppliedData(std::move(accentMeta), 0, HUNDRED_PERCENT));
+        appliedArticulations.preCalculateAverageData();
+
+        events.emplace_back(timestamp,
+                            m_nominalDuration,
+                            m_voiceIdx,
+                            pitchLevel(m_pitchClass, m_octave),
+                            dynamicLevelFromType(DynamicType::mf),
+                            std::move(appliedArticulations));
+    }
+
+    // [THEN] We expect that all the notes reference the very same curves
+    const NoteEvent& first = events.front();
+    const ExpressionCurve& firstExpressionCurve = first.expressionCtx().expressionCurve;
+    const PitchCurve& firstPitchCurve = first.pitchCtx().pitchCurve;
+    ASSERT_FALSE(firstExpressionCurve.empty());
+    ASSERT_FALSE(firstPitchCurve.empty());
+
+    for (const NoteEvent& event : events) {
+        EXPECT_EQ(event.expressionCtx().expressionCurve, firstExpressionCurve);
+        EXPECT_EQ(&*event.expressionCtx().expressionCurve.cbegin(), &*firstExpressionCurve.cbegin());
+        EXPECT_EQ(&*event.pitchCtx().pitchCurve.cbegin(), &*firstPitchCurve.cbegin());
+    }
+
+    // [WHEN] A copy of the shared curve being modified
+    ExpressionCurve modifiedCurve = firstExpressionCurve;
+    dynamic_level_t originalLevel = firstExpressionCurve.cbegin()->second;
+    modifiedCurve.begin()->second = originalLevel + DYNAMIC_LEVEL_STEP;
+
+    // [THEN] We expect that the notes are not affected
+    for (const NoteEvent& event : events) {
+        EXPECT_EQ(event.expressionCtx().expressionCurve.cbegin()->second, originalLevel);
+    }
+}
+
+/**
+ * @brief SingleNoteArticulationsTest_SharedCurves_LastOwnerModifies
+ * @details In this case we're gonna build a note, take a copy of its expression curve and drop the note.
+ *          The copy is the last owner of the shared curve, but modifying it must not touch the shared data,
+ *          so the notes built later with the same curve still get the original values
+ */
+TEST_F(Engraving_SingleNoteArticulationsTest, SharedCurves_LastOwnerModifies)
+{
+    // [GIVEN] Articulation pattern "Accent"
+    ArticulationPatternSegment accentArticulation;
+    accentArticulation.arrangementPattern = createArrangementPattern(HUNDRED_PERCENT /*duration_factor*/, 0 /*timestamp_offset*/);
+    accentArticulation.pitchPattern = createSimplePitchPattern(0 /*increment_pitch_diff*/);
+    accentArticulation.expressionPattern = createSimpleExpressionPattern(dynamicLevelFromType(DynamicType::mf));
+
+    ArticulationPattern scope;
+    scope.emplace(0, accentArticulation);
+
+    auto buildNote = [this, &scope]() {
+        ArticulationMeta accentMeta;
+        accentMeta.type = ArticulationType::Accent;
+        accentMeta.pattern = scope;
+        accentMeta.timestamp = m_nominalTimestamp;
+        accentMeta.overallDuration = m_nominalDuration;
+
+        ArticulationMap appliedArticulations = {};
+        appliedArticulations.emplace(ArticulationType::Accent, ArticulationAppliedData(std::move(accentMeta), 0, HUNDRED_PERCENT));
+        appliedArticulations.preCalculateAverageData();
+
+        return NoteEvent(m_nominalTimestamp,
+                         m_nominalDuration,
+                         m_voiceIdx,
+                         pitchLevel(m_pitchClass, m_octave),
+                         dynamicLevelFromType(DynamicType::mf),
+                         std::move(appliedArticulations));
+    };
+
+    // [GIVEN] Expression curve of a "mezzo forte" note with the accent applied, the note itself is dropped
+    ExpressionCurve curve = buildNote().expressionCtx().expressionCurve;
+
+    ASSERT_FALSE(curve.empty());
+    dynamic_level_t originalLevel = curve.cbegin()->second;
+
+    // [WHEN] The last owner of the curve modifies it
+    curve.begin()->second = originalLevel + DYNAMIC_LEVEL_STEP;
+
+    // [WHEN] The same note is built again
+    NoteEvent event = buildNote();
+
+    // [THEN] We expect that the new note has the original curve
+    EXPECT_EQ(event.expressionCtx().expressionCurve.cbegin()->second, originalLevel);
+    EXPECT_NE(&*event.expressionCtx().expressionCurve.cbegin(), &*curve.cbegin());
+}
@@ -23,12 +23,19 @@
 #include "pngwriter.h"
 
 #include <cmath>
+#include <thread>
+
+#include <QBuffer>
 #include <QImage>
 
 #include "libmscore/masterscore.h"
 #include "libmscore/page.h"
 #include "engraving/infrastructure/paint.h"
 
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+#include "orderedtaskpool.h"
+
 #include "log.h"
 
 using namespace mu::iex::imagesexport;
@@ -47,31 +54,111 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
+    const ImageParams params = imageParams(notation, options);
+    const int pageNumber = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
+
+    QByteArray png = renderPage(recordPage(notation, pageNumber, params.dpi), params);
+    if (destinationDevice.write(png) != png.size()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    return true;
+}
+
+mu::Ret PngWriter::writePages(INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    const ImageParams params = imageParams(notation, options);
+
+    Ret result = make_ret(Ret::Code::Ok);
+    auto onPageRendered = [&result, &devices](size_t pageNumber, QByteArray&& png) {
+        if (devices.at(pageNumber)->write(png) != png.size() && result) {
+            result = make_ret(Ret::Code::UnknownError);
+        }
+    };
+
+    //! NOTE The pages are recorded one by one on this thread, the score is not accessed from other threads,
+    //! and rasterized and encoded concurrently, at most a few recorded pages are kept in memory
+    size_t threadCount = std::min(static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())), devices.size());
+    OrderedTaskPool<QByteArray> pool(threadCount, onPageRendered, 0, "pngwriter");
+
+    for (size_t i = 0; i < devices.size(); ++i) {
+        auto data = std::make_shared<const draw::DrawData>(recordPage(notation, static_cast<int>(i), params.dpi));
+        pool.add([data, params]() {
+            return renderPage(*data, params);
+        });
+    }
+
+    pool.finish();
+
+    return result;
+}
+
+PngWriter::ImageParams PngWriter::imageParams(INotationPtr notation, const Options& options) const
+{
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
     const SizeF pageSizeInch = notation->painting()->pageSizeInch();
 
-    int width = std::lrint(pageSizeInch.width() * CANVAS_DPI);
-    int height = std::lrint(pageSizeInch.height() * CANVAS_DPI);
+    ImageParams params;
+    params.width = std::lrint(pageSizeInch.width() * CANVAS_DPI);
+    params.height = std::lrint(pageSizeInch.height() * CANVAS_DPI);
+    params.dpi = CANVAS_DPI;
+    params.transparentBackground = options.value(OptionKey::TRANSPARENT_BACKGROUND, Val(false)).toBool();
 
-    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
-    image.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
-    image.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
+    return params;
+}
 
-    const bool TRANSPARENT_BACKGROUND = options.value(OptionKey::TRANSPARENT_BACKGROUND, Val(false)).toBool();
-    image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
+mu::draw::DrawData PngWriter::recordPage(INotationPtr notation, int pageNumber, float dpi) const
+{
+    auto provider = std::make_shared<draw::BufferedPaintProvider>();
+    {
+        mu::draw::Painter painter(provider, "pngwriter");
 
-    mu::draw::Painter painter(&image, "pngwriter");
+        INotationPainting::Options opt;
+        opt.fromPage = pageNumber;
+        opt.toPage = opt.fromPage;
+        opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
+        opt.deviceDpi = dpi;
+        opt.printPageBackground = false; //Already printed
 
-    INotationPainting::Options opt;
-    opt.fromPage = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
-    opt.toPage = opt.fromPage;
-    opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
-    opt.deviceDpi = CANVAS_DPI;
-    opt.printPageBackground = false; //Already printed
+        notation->painting()->paintPng(&painter, opt);
 
-    notation->painting()->paintPng(&painter, opt);
+        painter.endDraw();
+    }
 
-    image.save(&destinationDevice, "png");
+    return provider->drawData();
+}
 
-    return true;
+QImage PngWriter::rasterizePage(const draw::DrawData& data, const ImageParams& params)
+{
+    QImage image(params.width, params.height, QImage::Format_ARGB32_Premultiplied);
+    image.setDotsPerMeterX(std::lrint((params.dpi * 1000) / mu::engraving::INCH));
+    image.setDotsPerMeterY(std::lrint((params.dpi * 1000) / mu::engraving::INCH));
+
+    image.fill(params.transparentBackground ? Qt::transparent : Qt::white);
+
+    {
+        mu::draw::Painter painter(&image, "pngwriter");
+        draw::DrawDataPaint::paint(&painter, data);
+        painter.endDraw();
+    }
+
+    return image;
+}
+
+QByteArray PngWriter::renderPage(const draw::DrawData& data, const ImageParams& params)
+{
+    QImage image = rasterizePage(data, params);
+
+    QByteArray png;
+    QBuffer buffer(&png);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "png");
+
+    return png;
 }
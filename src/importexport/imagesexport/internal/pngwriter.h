@@ -23,8 +23,12 @@
 #ifndef MU_IMPORTEXPORT_PNGWRITER_H
 #define MU_IMPORTEXPORT_PNGWRITER_H
 
+#include <QImage>
+
 #include "abstractimagewriter.h"
 
+#include "draw/buffereddrawtypes.h"
+
 #include "../iimagesexportconfiguration.h"
 #include "modularity/ioc.h"
 
@@ -36,6 +40,22 @@ class PngWriter : public AbstractImageWriter
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
+    Ret writePages(notation::INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options = Options()) override;
+
+    struct ImageParams {
+        int width = 0;
+        int height = 0;
+        float dpi = 0.0;
+        bool transparentBackground = false;
+    };
+
+    //! NOTE Paint the recorded page, don't access the score, so can be called from any thread
+    static QImage rasterizePage(const draw::DrawData& data, const ImageParams& params);
+    static QByteArray renderPage(const draw::DrawData& data, const ImageParams& params);
+
+private:
+    ImageParams imageParams(notation::INotationPtr notation, const Options& options) const;
+    draw::DrawData recordPage(notation::INotationPtr notation, int pageNumber, float dpi) const;
 };
 }
 
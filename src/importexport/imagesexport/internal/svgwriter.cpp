@@ -142,8 +142,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
                 for (mu::engraving::MeasureBase* measure = firstMeasure; measure; measure = system->nextMeasure(measure)) {
                     if (measure->isMeasure() && mu::engraving::toMeasure(measure)->visible(staffIndex)) {
                         mu::engraving::StaffLines* sl = mu::engraving::toMeasure(measure)->staffLines(static_cast<int>(staffIndex));
-                        printer.setElement(sl);
-                        engraving::Paint::paintElement(painter, sl);
+                        paintElement(painter, printer, sl);
                     }
                 }
             } else {   // Draw staff lines once per system
@@ -158,8 +157,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
                     lines[l].setP2(mu::PointF(lastX, lines[l].p2().y()));
                 }
 
-                printer.setElement(firstSL);
-                engraving::Paint::paintElement(painter, firstSL);
+                paintElement(painter, printer, firstSL);
             }
         }
     }
@@ -215,11 +213,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
             break;
         }
 
-        // Set the EngravingItem pointer inside SvgGenerator/SvgPaintEngine
-        printer.setElement(element);
-
-        // Paint it
-        engraving::Paint::paintElement(painter, element);
+        paintElement(painter, printer, element);
     }
 
     painter.endDraw(); // Writes MuseScore SVG file to disk, finally
@@ -233,6 +227,17 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     return true;
 }
 
+void SvgWriter::paintElement(draw::Painter& painter, SvgGenerator& printer, const engraving::EngravingItem* element)
+{
+    painter.flushSymbols();
+
+    // Set the EngravingItem pointer inside SvgGenerator/SvgPaintEngine
+    printer.setElement(element);
+
+    // Paint it
+    engraving::Paint::paintElement(painter, element);
+}
+
 SvgWriter::BeatsColors SvgWriter::parseBeatsColors(const QVariant& obj) const
 {
     QVariantMap map = obj.toMap();
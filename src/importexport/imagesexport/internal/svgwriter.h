@@ -28,6 +28,16 @@
 #include "modularity/ioc.h"
 #include "iimagesexportconfiguration.h"
 
+class SvgGenerator;
+
+namespace mu::draw {
+class Painter;
+}
+
+namespace mu::engraving {
+class EngravingItem;
+}
+
 namespace mu::iex::imagesexport {
 class SvgWriter : public AbstractImageWriter
 {
@@ -37,6 +47,10 @@ public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
 
+    //! NOTE The painter collects the symbols into runs, the run of the previous element
+    //! is flushed before switching the element, otherwise its symbols would get the class of the next one
+    static void paintElement(draw::Painter& painter, SvgGenerator& printer, const engraving::EngravingItem* element);
+
 private:
     using BeatsColors = QHash<int /* beatIndex */, QColor>;
 
@@ -0,0 +1,214 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+#include <QBuffer>
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "engraving/infrastructure/paint.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/mscore.h"
+
+#include "engraving/utests/utils/scorerw.h"
+
+#include "importexport/imagesexport/internal/pngwriter.h"
+
+#include "orderedtaskpool.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::iex::imagesexport;
+
+static const String PNG_DIR("data/");
+
+class ImagesExport_PngWriterTests : public ::testing::Test
+{
+public:
+    static constexpr float EXPORT_DPI = 150.0f;
+
+    static PngWriter::ImageParams imageParams(const Page* page)
+    {
+        PngWriter::ImageParams params;
+        params.width = std::lrint(page->width() * EXPORT_DPI / mu::engraving::DPI);
+        params.height = std::lrint(page->height() * EXPORT_DPI / mu::engraving::DPI);
+        params.dpi = EXPORT_DPI;
+        return params;
+    }
+
+    //! NOTE The same painting calls for the recording and for the direct painting
+    static void paintPage(draw::Painter& painter, Page* page)
+    {
+        double scale = EXPORT_DPI / mu::engraving::DPI;
+        painter.setAntialiasing(true);
+        painter.scale(scale, scale);
+        painter.setClipping(true);
+        painter.setClipRect(page->bbox());
+        Paint::paintElements(painter, page->elements(), true);
+        painter.setClipping(false);
+    }
+
+    static draw::DrawData recordPage(Page* page)
+    {
+        auto provider = std::make_shared<draw::BufferedPaintProvider>();
+        {
+            draw::Painter painter(provider, "pngwriter_tests");
+            paintPage(painter, page);
+            painter.endDraw();
+        }
+        return provider->drawData();
+    }
+
+    static QImage paintPageDirectly(Page* page)
+    {
+        const PngWriter::ImageParams params = imageParams(page);
+        QImage image(params.width, params.height, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::white);
+        {
+            draw::Painter painter(&image, "pngwriter_tests");
+            paintPage(painter, page);
+            painter.endDraw();
+        }
+        return image;
+    }
+
+    static QByteArray encode(const QImage& image)
+    {
+        QByteArray png;
+        QBuffer buffer(&png);
+        buffer.open(QIODevice::WriteOnly);
+        image.save(&buffer, "png");
+        return png;
+    }
+
+    //! NOTE Pixels whose channels differ more than the rounding of the antialiasing
+    static size_t differentPixels(const QImage& image1, const QImage& image2)
+    {
+        static constexpr int TOLERANCE = 2;
+
+        size_t count = 0;
+        for (int y = 0; y < image1.height(); ++y) {
+            const QRgb* line1 = reinterpret_cast<const QRgb*>(image1.constScanLine(y));
+            const QRgb* line2 = reinterpret_cast<const QRgb*>(image2.constScanLine(y));
+            for (int x = 0; x < image1.width(); ++x) {
+                if (std::abs(qRed(line1[x]) - qRed(line2[x])) > TOLERANCE
+                    || std::abs(qGreen(line1[x]) - qGreen(line2[x])) > TOLERANCE
+                    || std::abs(qBlue(line1[x]) - qBlue(line2[x])) > TOLERANCE
+                    || std::abs(qAlpha(line1[x]) - qAlpha(line2[x])) > TOLERANCE) {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+};
+
+TEST_F(ImagesExport_PngWriterTests, RecordedPage_SameAsDirectPaint)
+{
+    //! [GIVEN] Dense score, with symbols, texts and lines
+    MasterScore* score = ScoreRW::readScore(PNG_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    score->setPrinting(true);
+
+    for (Page* page : score->pages()) {
+        //! [WHEN] The page is recorded and rasterized the way the png export does
+        QImage rasterized = PngWriter::rasterizePage(recordPage(page), imageParams(page));
+
+        //! [WHEN] The page is painted directly
+        QImage direct = paintPageDirectly(page);
+
+        //! [THEN] The pictures are the same
+        ASSERT_EQ(rasterized.size(), direct.size());
+        EXPECT_EQ(differentPixels(rasterized, direct), 0) << "page: " << page->no();
+    }
+
+    delete score;
+}
+
+/**
+ * @brief ImagesExport_PngWriterTests_Benchmark_LargeScore
+ * @details Exports the pages of a score to png several times: painted and encoded one by one on this thread,
+ *          and recorded on this thread, then rasterized and encoded concurrently as PngWriter::writePages does.
+ *          Prints the wall-clock time of each
+ */
+TEST_F(ImagesExport_PngWriterTests, Benchmark_LargeScore)
+{
+    constexpr int PASSES = 3;
+
+    MasterScore* score = ScoreRW::readScore(PNG_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+    score->setPrinting(true);
+
+    const std::vector<Page*>& pages = score->pages();
+
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<size_t> serialSizes;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        serialSizes.clear();
+        for (Page* page : pages) {
+            serialSizes.push_back(static_cast<size_t>(encode(paintPageDirectly(page)).size()));
+        }
+    }
+    auto serialEnd = std::chrono::steady_clock::now();
+
+    size_t threadCount = std::min(static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())), pages.size());
+    std::vector<size_t> concurrentSizes;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        concurrentSizes.clear();
+        OrderedTaskPool<QByteArray> pool(threadCount, [&concurrentSizes](size_t, QByteArray&& png) {
+            concurrentSizes.push_back(static_cast<size_t>(png.size()));
+        }, 0, "pngwriter_tests");
+
+        for (Page* page : pages) {
+            auto data = std::make_shared<const draw::DrawData>(recordPage(page));
+            const PngWriter::ImageParams params = imageParams(page);
+            pool.add([data, params]() {
+                return PngWriter::renderPage(*data, params);
+            });
+        }
+
+        pool.finish();
+    }
+    auto concurrentEnd = std::chrono::steady_clock::now();
+
+    LOGI() << "pages: " << pages.size() << ", passes: " << PASSES << ", threads: " << threadCount
+           << ", one by one: " << std::chrono::duration_cast<std::chrono::milliseconds>(serialEnd - begin).count() << " ms"
+           << ", concurrent: " << std::chrono::duration_cast<std::chrono::milliseconds>(concurrentEnd - serialEnd).count() << " ms";
+
+    //! [THEN] All pages are exported, in the page order
+    EXPECT_EQ(serialSizes.size(), pages.size());
+    EXPECT_EQ(concurrentSizes.size(), pages.size());
+
+    delete score;
+}
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <QBuffer>
+
+#include "draw/painter.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/mscore.h"
+
+#include "engraving/utests/utils/scorerw.h"
+
+#include "importexport/imagesexport/internal/svggenerator.h"
+#include "importexport/imagesexport/internal/svgwriter.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::iex::imagesexport;
+
+static const String SVG_DIR("data/");
+
+class ImagesExport_SvgWriterTests : public ::testing::Test
+{
+};
+
+TEST_F(ImagesExport_SvgWriterTests, ElementSymbols_KeepElementClass)
+{
+    //! [GIVEN] Score with several notes, their noteheads are drawn with the same font and pen
+    MasterScore* score = ScoreRW::readScore(SVG_DIR + u"svg_symbols.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    score->setPrinting(true);
+    Page* page = score->pages().front();
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    SvgGenerator printer;
+    printer.setOutputDevice(&buffer);
+    printer.setSize(QSize(page->width(), page->height()));
+    printer.setViewBox(QRectF(0, 0, page->width(), page->height()));
+
+    //! [WHEN] Page elements are painted one by one, like the svg export does
+    size_t notesCount = 0;
+    {
+        draw::Painter painter(&printer, "svgwriter_tests");
+
+        std::vector<EngravingItem*> elements = page->elements();
+        std::sort(elements.begin(), elements.end(), elementLessThan);
+
+        for (const EngravingItem* element : elements) {
+            if (!element->visible()) {
+                continue;
+            }
+
+            if (element->isNote()) {
+                ++notesCount;
+            }
+
+            SvgWriter::paintElement(painter, printer, element);
+        }
+
+        painter.endDraw();
+    }
+
+    //! [THEN] Each notehead is written with the class of its own note, not of the next painted element
+    QString svg = QString::fromUtf8(buffer.data());
+    EXPECT_GT(notesCount, 1);
+    EXPECT_EQ(static_cast<size_t>(svg.count(QStringLiteral("class=\"Note\""))), notesCount);
+
+    delete score;
+}
@@ -235,6 +235,26 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
     m_pauseMap.calculate(m_score);
     writeHeader();
 
+    //! NOTE Collect the events of each staff once, instead of passing all the events for each channel of each staff
+    std::vector<std::vector<EventMap::const_iterator> > staffEvents(tracks.size());
+    for (auto i = events.cbegin(); i != events.cend(); ++i) {
+        const NPlayEvent& event = i->second;
+        if (event.isMuted()) {
+            continue;
+        }
+
+        const int origin = event.getOriginatingStaff();
+        if (origin >= 0 && origin < static_cast<int>(staffEvents.size())) {
+            staffEvents[origin].push_back(i);
+        }
+
+        // restruck notes are turned off in the track of the discarding staff
+        const int restrike = event.velo() > 0 ? event.discard() - 1 : -1;
+        if (restrike >= 0 && restrike != origin && restrike < static_cast<int>(staffEvents.size())) {
+            staffEvents[restrike].push_back(i);
+        }
+    }
+
     int staffIdx = 0;
     for (auto& track: tracks) {
         Staff* staff = m_score->staff(staffIdx);
@@ -295,7 +315,7 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                     track.insert(0, ev);
                 }
 
-                for (auto i = events.begin(); i != events.end(); ++i) {
+                for (const EventMap::const_iterator& i : staffEvents[staffIdx]) {
                     const NPlayEvent& event = i->second;
 
                     if (event.isMuted()) {
@@ -21,6 +21,11 @@
  */
 #include "videowriter.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "videoencoder.h"
 
 #include "engraving/libmscore/page.h"
@@ -36,6 +41,86 @@ using namespace mu::iex::videoexport;
 using namespace mu::project;
 using namespace mu::notation;
 
+//! NOTE Encodes the frames on its own thread, so the painting of the next frames
+//! overlaps with the encoding. The queue is bounded, the painting waits if the encoder is behind
+class EncoderThread
+{
+public:
+    EncoderThread(VideoEncoder& encoder, size_t maxQueued)
+        : m_encoder(encoder), m_maxQueued(maxQueued)
+    {
+        m_thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    ~EncoderThread()
+    {
+        finish();
+    }
+
+    //! NOTE The frame is implicitly shared, so the same image can be pushed several times without a copy
+    void push(const QImage& frame)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_dequeued.wait(lock, [this]() {
+                return m_frames.size() < m_maxQueued;
+            });
+            m_frames.push_back(frame);
+        }
+        m_queued.notify_one();
+    }
+
+    void finish()
+    {
+        if (!m_thread.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_finished = true;
+        }
+        m_queued.notify_one();
+        m_thread.join();
+    }
+
+private:
+    void run()
+    {
+        while (true) {
+            QImage frame;
+            {
+                std::unique_lock lock(m_mutex);
+                m_queued.wait(lock, [this]() {
+                    return m_finished || !m_frames.empty();
+                });
+
+                if (m_frames.empty()) {
+                    return;
+                }
+
+                frame = std::move(m_frames.front());
+                m_frames.pop_front();
+            }
+            m_dequeued.notify_one();
+
+            m_encoder.encodeImage(frame);
+        }
+    }
+
+    VideoEncoder& m_encoder;
+    size_t m_maxQueued = 0;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_queued;
+    std::condition_variable m_dequeued;
+    std::deque<QImage> m_frames;
+    bool m_finished = false;
+};
+
 std::vector<IProjectWriter::UnitType> VideoWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART };
@@ -154,18 +239,30 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+    auto painting = masterNotation->notation()->painting();
 
-    QPainter qp(&frame);
-    qp.setRenderHint(QPainter::Antialiasing, true);
-    qp.setRenderHint(QPainter::TextAntialiasing, true);
-    RectF frameRect = RectF::fromQRectF(QRectF(frame.rect()));
+    //! NOTE The page image changes only at the page turns, so each page is painted once
+    //! and only the cursor is painted on a copy of it for the frames
+    QImage pageImage(config.width, config.height, QImage::Format_RGB32);
+    pageImage.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+    pageImage.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / Ms::INCH));
+    const Page* pageImagePage = nullptr;
 
-    draw::Painter painter(&qp, "video_writer");
+    auto paintPage = [&pageImage, &painting, CANVAS_DPI](const Page* page) {
+        QPainter qp(&pageImage);
+        qp.setRenderHint(QPainter::Antialiasing, true);
+        qp.setRenderHint(QPainter::TextAntialiasing, true);
 
-    auto painting = masterNotation->notation()->painting();
+        draw::Painter painter(&qp, "video_writer");
+        painter.fillRect(RectF::fromQRectF(QRectF(pageImage.rect())), draw::Color::white);
+
+        INotationPainting::Options opt;
+        opt.fromPage = page->no();
+        opt.toPage = opt.fromPage;
+        opt.deviceDpi = CANVAS_DPI;
+
+        painting->paintPrint(&painter, opt);
+    };
 
     // Setup duration
     INotationPlaybackPtr playback = masterNotation->playback();
@@ -189,6 +286,12 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     PlaybackCursor cursor;
     cursor.setNotation(masterNotation->notation());
 
+    //! NOTE A second of frames at most, each frame is a full image
+    EncoderThread encoderThread(encoder, static_cast<size_t>(std::max(config.fps, 1)));
+
+    QImage frame;
+    RectF frameCursorRect;
+
     for (int f = 0; f < frameCount; f++) {
         float currentTimeSec = (qreal)f / config.fps;
         currentTimeSec -= config.leadingSec;
@@ -206,14 +309,11 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
-
-        painter.fillRect(frameRect, draw::Color::white);
-
-        painting->paintPrint(&painter, opt);
+        bool pageChanged = page != pageImagePage;
+        if (pageChanged) {
+            paintPage(page);
+            pageImagePage = page;
+        }
 
         cursor.move(tick);
 
@@ -221,11 +321,24 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
         PointF pagePos = page->pos();
         RectF cursorAbsRect = cursorRect.translated(-pagePos);
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        //! NOTE The cursor moves by chords, so consecutive frames are often the same image
+        if (pageChanged || frame.isNull() || cursorAbsRect != frameCursorRect) {
+            frame = pageImage.copy();
+            frameCursorRect = cursorAbsRect;
+
+            QPainter qp(&frame);
+            draw::Painter painter(&qp, "video_writer");
 
-        encoder.encodeImage(frame);
+            //! NOTE The cursor rect is in the score units, the page is painted with the same scale (see paintPrint)
+            painter.scale(CANVAS_DPI / Ms::DPI, CANVAS_DPI / Ms::DPI);
+            painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        }
+
+        encoderThread.push(frame);
     }
 
+    encoderThread.finish();
+
     encoder.close();
 
     return make_ok();
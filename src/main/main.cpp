@@ -173,6 +173,7 @@ int main(int argc, char** argv)
 
     //! NOTE `diagnostics` must be first, because it installs the crash handler.
     //! For other modules, the order is (an should be) unimportant.
+    //! Modules added as EditorOnly are not initialized in the converter mode.
     app.addModule(new mu::diagnostics::DiagnosticsModule());
     app.addModule(new mu::draw::DrawModule());
     app.addModule(new mu::fonts::FontsModule());
@@ -208,7 +209,7 @@ int main(int argc, char** argv)
     app.addModule(new mu::musesampler::MuseSamplerModule());
 #endif
 
-    app.addModule(new mu::learn::LearnModule());
+    app.addModule(new mu::learn::LearnModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 
     app.addModule(new mu::engraving::EngravingModule());
     app.addModule(new mu::notation::NotationModule());
@@ -222,9 +223,9 @@ int main(int argc, char** argv)
 #endif
 
 #ifdef BUILD_INSTRUMENTSSCENE_MODULE
-    app.addModule(new mu::instrumentsscene::InstrumentsSceneModule());
+    app.addModule(new mu::instrumentsscene::InstrumentsSceneModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #else
-    app.addModule(new mu::instrumentsscene::InstrumentsSceneStubModule());
+    app.addModule(new mu::instrumentsscene::InstrumentsSceneStubModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #endif
 
 #ifdef BUILD_VST
@@ -233,11 +234,11 @@ int main(int argc, char** argv)
     app.addModule(new mu::vst::VstStubModule());
 #endif
 
-    app.addModule(new mu::inspector::InspectorModule());
+    app.addModule(new mu::inspector::InspectorModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #ifdef BUILD_PALETTE_MODULE
-    app.addModule(new mu::palette::PaletteModule());
+    app.addModule(new mu::palette::PaletteModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #else
-    app.addModule(new mu::palette::PaletteStubModule());
+    app.addModule(new mu::palette::PaletteStubModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #endif
     app.addModule(new mu::converter::ConverterModule());
 
@@ -264,14 +265,14 @@ int main(int argc, char** argv)
     app.addModule(new mu::workspace::WorkspaceStubModule());
 #endif
 #ifdef BUILD_PLUGINS_MODULE
-    app.addModule(new mu::plugins::PluginsModule());
+    app.addModule(new mu::plugins::PluginsModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #else
-    app.addModule(new mu::plugins::PluginsStubModule());
+    app.addModule(new mu::plugins::PluginsStubModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #endif
 #ifdef BUILD_CLOUD_MODULE
-    app.addModule(new mu::cloud::CloudModule());
+    app.addModule(new mu::cloud::CloudModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #else
-    app.addModule(new mu::cloud::CloudStubModule());
+    app.addModule(new mu::cloud::CloudStubModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #endif
 #ifdef BUILD_LANGUAGES_MODULE
     app.addModule(new mu::languages::LanguagesModule());
@@ -282,7 +283,7 @@ int main(int argc, char** argv)
     app.addModule(new mu::mi::MultiInstancesModule());
 
 #ifdef BUILD_AUTOBOT_MODULE
-    app.addModule(new mu::autobot::AutobotModule());
+    app.addModule(new mu::autobot::AutobotModule(), mu::appshell::AppShell::ModuleRunMode::EditorOnly);
 #endif
 
 #else
@@ -26,6 +26,7 @@
 #include "notationtypes.h"
 
 #include "draw/painter.h"
+#include "draw/buffereddrawtypes.h"
 
 namespace mu::notation {
 class INotationPainting
@@ -39,6 +40,7 @@ public:
         bool isPrinting = false;
         bool isMultiPage = false;
         bool printPageBackground = true;
+        bool isPaintInteraction = true;
         RectF frameRect;
         int fromPage = -1; // 0 is first
         int toPage = -1;
@@ -49,6 +51,21 @@ public:
         std::function<void()> onNewPage;
     };
 
+    //! NOTE Recorded content of a page, see pageDisplayLists
+    struct DisplayList
+    {
+        RectF rect; // page coordinates
+        std::shared_ptr<const draw::DrawData> data;
+        uint64_t hash = 0; // of the content, see DrawComp::hash
+    };
+
+    struct PageDisplayLists
+    {
+        PointF pos;
+        RectF rect; // page coordinates
+        std::vector<DisplayList> lists; // the page sheet first, in paint order
+    };
+
     virtual void setViewMode(const ViewMode& vm) = 0;
     virtual ViewMode viewMode() const = 0;
 
@@ -56,6 +73,17 @@ public:
     virtual SizeF pageSizeInch() const = 0;
 
     virtual void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE The view painting split for the raster cache of the view:
+    //! the pages without the interaction (selection area, drop targets, etc.) and the interaction only
+    virtual void paintViewPages(draw::Painter* painter, const RectF& frameRect) = 0;
+    virtual void paintViewInteraction(draw::Painter* painter) = 0;
+
+    //! NOTE The display lists of the pages intersecting the frame,
+    //! the pages which are not recorded yet have no lists.
+    //! The lists are immutable, so they can be painted on any thread
+    virtual std::vector<PageDisplayLists> pageDisplayLists(const RectF& frameRect) = 0;
+
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
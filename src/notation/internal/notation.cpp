@@ -71,9 +71,14 @@ Notation::Notation(mu::engraving::Score* score)
     });
 
     m_interaction->dropChanged().onNotify(this, [this]() {
+        m_painting->invalidateDisplayLists();
         notifyAboutNotationChanged();
     });
 
+    m_interaction->selectionChanged().onNotify(this, [this]() {
+        m_painting->invalidateDisplayLists();
+    });
+
     m_midiInput->noteChanged().onNotify(this, [this]() {
         notifyAboutNotationChanged();
     });
@@ -37,6 +37,7 @@ class Score;
 namespace mu::notation {
 class NotationInteraction;
 class NotationPlayback;
+class NotationPainting;
 class Notation : virtual public INotation, public IGetScore, public async::Asyncable
 {
     INJECT_STATIC(notation, INotationConfiguration, configuration)
@@ -95,7 +96,7 @@ private:
 
     async::Notification m_openChanged;
 
-    INotationPaintingPtr m_painting = nullptr;
+    std::shared_ptr<NotationPainting> m_painting = nullptr;
     INotationViewStatePtr m_viewState = nullptr;
     INotationInteractionPtr m_interaction = nullptr;
     INotationStylePtr m_style = nullptr;
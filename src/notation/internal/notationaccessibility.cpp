@@ -72,8 +72,12 @@ mu::ValCh<std::string> NotationAccessibility::accessibilityInfo() const
 void NotationAccessibility::setMapToScreenFunc(const AccessibleMapToScreenFunc& func)
 {
 #ifndef ENGRAVING_NO_ACCESSIBILITY
-    score()->rootItem()->accessible()->accessibleRoot()->setMapToScreenFunc(func);
-    score()->dummy()->rootItem()->accessible()->accessibleRoot()->setMapToScreenFunc(func);
+    //! NOTE The func is reset when the view goes away, that must not make the roots
+    for (AccessibleRoot* root : accessibleRoots(bool(func))) {
+        if (root) {
+            root->setMapToScreenFunc(func);
+        }
+    }
 #else
     UNUSED(func)
 #endif
@@ -82,15 +86,21 @@ void NotationAccessibility::setMapToScreenFunc(const AccessibleMapToScreenFunc&
 void NotationAccessibility::setEnabled(bool enabled)
 {
 #ifndef ENGRAVING_NO_ACCESSIBILITY
-    std::vector<AccessibleRoot*> roots {
-        score()->rootItem()->accessible()->accessibleRoot(),
-        score()->dummy()->rootItem()->accessible()->accessibleRoot()
-    };
-
     EngravingItem* selectedElement = selection()->element();
+
+    //! NOTE The accessible items are made on demand, the element may be selected
+    //! before an accessibility client became active
+    if (enabled && selectedElement) {
+        selectedElement->initAccessibleIfNeed();
+    }
+
     AccessibleItemPtr selectedElementAccItem = selectedElement ? selectedElement->accessible() : nullptr;
 
-    for (AccessibleRoot* root : roots) {
+    for (AccessibleRoot* root : accessibleRoots()) {
+        if (!root) {
+            continue;
+        }
+
         root->setEnabled(enabled);
 
         if (!enabled) {
@@ -111,6 +121,30 @@ void NotationAccessibility::setEnabled(bool enabled)
 #endif
 }
 
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+std::vector<AccessibleRoot*> NotationAccessibility::accessibleRoots(bool setupIfNeed) const
+{
+    if (!engravingConfiguration()->isAccessibleEnabled()) {
+        return {};
+    }
+
+    //! NOTE The accessible roots are made on demand, only for the scores that are shown
+    std::vector<AccessibleRoot*> roots;
+
+    for (RootItem* rootItem : { score()->rootItem(), score()->dummy()->rootItem() }) {
+        if (setupIfNeed) {
+            rootItem->setupAccessible();
+        }
+
+        AccessibleItemPtr accessible = rootItem->accessible();
+        roots.push_back(accessible ? accessible->accessibleRoot() : nullptr);
+    }
+
+    return roots;
+}
+
+#endif
+
 void NotationAccessibility::updateAccessibilityInfo()
 {
     if (!score()) {
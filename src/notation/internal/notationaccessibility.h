@@ -28,17 +28,25 @@
 
 #include "async/asyncable.h"
 #include "async/notification.h"
+#include "modularity/ioc.h"
+#include "engraving/iengravingconfiguration.h"
 
 namespace Ms {
 class Score;
 class Selection;
 }
 
+namespace mu::engraving {
+class AccessibleRoot;
+}
+
 namespace mu::notation {
 class IGetScore;
 class Notation;
 class NotationAccessibility : public INotationAccessibility, public async::Asyncable
 {
+    INJECT(notation, engraving::IEngravingConfiguration, engravingConfiguration)
+
 public:
     NotationAccessibility(const Notation* notation);
 
@@ -52,6 +60,11 @@ private:
     const engraving::Score* score() const;
     const engraving::Selection* selection() const;
 
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+    //! NOTE Without setup, only the roots that are already made
+    std::vector<engraving::AccessibleRoot*> accessibleRoots(bool setupIfNeed = true) const;
+#endif
+
     void updateAccessibilityInfo();
 
     void setAccessibilityInfo(const QString& info);
@@ -0,0 +1,237 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationdisplaylists.h"
+
+#include <map>
+
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawcomp.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "engraving/infrastructure/paint.h"
+#include "engraving/libmscore/engravingitem.h"
+#include "engraving/libmscore/mscore.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/system.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::engraving;
+using namespace mu::draw;
+
+//! NOTE Enough for the pages visible at once in any view mode,
+//! the lists of an orchestral page take a few megabytes
+static constexpr size_t MAX_PAGES = 16;
+
+bool NotationDisplayLists::paintPage(Painter* painter, Page* page, const RectF& rect)
+{
+    PageList& list = m_pages[page];
+    list.lastUse = ++m_useCounter;
+
+    if (list.layoutStamp != page->layoutStamp() || list.pixelRatio != MScore::pixelRatio) {
+        list = PageList();
+        list.layoutStamp = page->layoutStamp();
+        list.pixelRatio = MScore::pixelRatio;
+        list.lastUse = m_useCounter;
+
+        removeLeastUsed();
+        return false;
+    }
+
+    if (!list.isRecorded) {
+        record(list, page);
+    }
+
+    for (const SystemList& system : list.systems) {
+        if (system.rect.intersects(rect)) {
+            DrawDataPaint::paint(painter, *system.data);
+        }
+    }
+    return true;
+}
+
+bool NotationDisplayLists::pageDisplayLists(const Page* page, const PaintSheet& paintSheet, INotationPainting::PageDisplayLists& out)
+{
+    auto it = m_pages.find(page);
+    if (it == m_pages.end()) {
+        return false;
+    }
+
+    PageList& list = it->second;
+    if (!list.isRecorded || list.layoutStamp != page->layoutStamp() || list.pixelRatio != MScore::pixelRatio) {
+        return false;
+    }
+
+    if (!list.sheet.data) {
+        auto provider = std::make_shared<BufferedPaintProvider>();
+        {
+            Painter painter(provider, "pagesheet");
+            painter.setAntialiasing(true);
+            paintSheet(&painter, page);
+            painter.endDraw();
+        }
+        list.sheet.rect = page->bbox();
+        list.sheet.data = std::make_shared<const DrawData>(provider->drawData());
+        list.sheet.hash = DrawComp::hash(*list.sheet.data);
+    }
+
+    list.lastUse = ++m_useCounter;
+
+    out.lists.clear();
+    out.lists.reserve(list.systems.size() + 1);
+    out.lists.push_back(list.sheet);
+    out.lists.insert(out.lists.end(), list.systems.begin(), list.systems.end());
+
+    return true;
+}
+
+void NotationDisplayLists::record(PageList& list, Page* page) const
+{
+    TRACEFUNC;
+
+    //! NOTE Elements are grouped by system, elements outside of systems (ex. header, footer) make one more group
+    std::vector<ElementGroup> groups;
+    std::map<const EngravingItem*, size_t> systemGroups;
+    for (const System* s : page->systems()) {
+        systemGroups[s] = groups.size();
+        groups.emplace_back();
+    }
+
+    ElementGroup pageElements;
+
+    for (EngravingItem* element : page->items(page->bbox())) {
+        if (!element->isInteractionAvailable()) {
+            continue;
+        }
+
+        ElementGroup* group = &pageElements;
+        const EngravingItem* system = element->findAncestor(ElementType::SYSTEM);
+        if (system) {
+            auto it = systemGroups.find(system);
+            if (it == systemGroups.end()) {
+                it = systemGroups.emplace(system, groups.size()).first;
+                groups.emplace_back();
+            }
+            group = &groups.at(it->second);
+        }
+
+        group->rect.unite(element->pageBoundingRect());
+        group->elements.push_back(element);
+    }
+
+    groups.push_back(std::move(pageElements));
+
+    mergeOverlappingGroups(groups, page->spatium());
+
+    for (ElementGroup& group : groups) {
+        if (group.elements.empty()) {
+            continue;
+        }
+
+        //! NOTE Sorted the same way as in Paint::paintElements
+        std::sort(group.elements.begin(), group.elements.end(), mu::engraving::elementLessThan);
+
+        SystemList system;
+        system.rect = group.rect;
+
+        auto provider = std::make_shared<BufferedPaintProvider>();
+        {
+            Painter painter(provider, "displaylist");
+            painter.setAntialiasing(true);
+
+            for (const EngravingItem* element : group.elements) {
+                Paint::paintElement(painter, element);
+            }
+
+            painter.endDraw();
+        }
+
+        system.data = std::make_shared<const DrawData>(provider->drawData());
+        system.hash = DrawComp::hash(*system.data);
+        list.systems.push_back(std::move(system));
+    }
+
+    list.isRecorded = true;
+}
+
+void NotationDisplayLists::mergeOverlappingGroups(std::vector<ElementGroup>& groups, double margin)
+{
+    //! NOTE Paint::paintElements paints the whole page sorted by z, the groups are painted one after another.
+    //! The order of the elements of different groups only matters where they can cover the same pixels,
+    //! so the groups whose rects (with a margin for the antialiasing) intersect are merged and sorted together,
+    //! that gives the same picture as the page-wide sort
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (size_t i = 0; i < groups.size() && !merged; ++i) {
+            if (groups.at(i).elements.empty()) {
+                continue;
+            }
+
+            RectF rect = groups.at(i).rect.adjusted(-margin, -margin, margin, margin);
+            for (size_t j = i + 1; j < groups.size(); ++j) {
+                ElementGroup& other = groups.at(j);
+                if (other.elements.empty() || !rect.intersects(other.rect)) {
+                    continue;
+                }
+
+                ElementGroup& group = groups.at(i);
+                group.rect.unite(other.rect);
+                group.elements.insert(group.elements.end(), other.elements.begin(), other.elements.end());
+                other = ElementGroup();
+                merged = true;
+                break;
+            }
+        }
+    }
+}
+
+void NotationDisplayLists::invalidate()
+{
+    m_pages.clear();
+}
+
+void NotationDisplayLists::removeStalePages(const std::vector<Page*>& pages)
+{
+    for (auto it = m_pages.begin(); it != m_pages.end();) {
+        if (std::find(pages.begin(), pages.end(), it->first) == pages.end()) {
+            it = m_pages.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void NotationDisplayLists::removeLeastUsed()
+{
+    while (m_pages.size() > MAX_PAGES) {
+        auto leastUsed = m_pages.begin();
+        for (auto it = m_pages.begin(); it != m_pages.end(); ++it) {
+            if (it->second.lastUse < leastUsed->second.lastUse) {
+                leastUsed = it;
+            }
+        }
+        m_pages.erase(leastUsed);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONDISPLAYLISTS_H
+#define MU_NOTATION_NOTATIONDISPLAYLISTS_H
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "draw/painter.h"
+#include "draw/buffereddrawtypes.h"
+
+#include "../inotationpainting.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class Page;
+}
+
+namespace mu::notation {
+//! NOTE Retained display lists of the pages for the screen painting.
+//! The page elements are recorded per system through BufferedPaintProvider
+//! and replayed on repaint (scroll, zoom). The lists are invalidated per page:
+//! layout re-positions all systems of a page it collects, so all lists of the page are recorded again.
+class NotationDisplayLists
+{
+public:
+    NotationDisplayLists() = default;
+
+    //! NOTE Paints the elements of the page intersecting the rect (in page coordinates).
+    //! Returns false if the page must be painted directly:
+    //! a list is recorded on the second paint of an unchanged page,
+    //! so pages that change on every paint (ex. dragging) don't pay for the recording
+    bool paintPage(draw::Painter* painter, engraving::Page* page, const RectF& rect);
+
+    //! NOTE Returns the recorded lists of the page with the page sheet first, doesn't record the page.
+    //! The sheet is recorded once per page list with paintSheet
+    using PaintSheet = std::function<void (draw::Painter* painter, const engraving::Page* page)>;
+    bool pageDisplayLists(const engraving::Page* page, const PaintSheet& paintSheet, INotationPainting::PageDisplayLists& out);
+
+    void invalidate();
+    void removeStalePages(const std::vector<engraving::Page*>& pages);
+
+private:
+    using SystemList = INotationPainting::DisplayList;
+
+    struct PageList {
+        uint64_t layoutStamp = 0;
+        double pixelRatio = 0.0;
+        bool isRecorded = false;
+        uint64_t lastUse = 0;
+        std::vector<SystemList> systems;
+        SystemList sheet;
+    };
+
+    struct ElementGroup {
+        RectF rect;
+        std::vector<engraving::EngravingItem*> elements;
+    };
+
+    void record(PageList& list, engraving::Page* page) const;
+    static void mergeOverlappingGroups(std::vector<ElementGroup>& groups, double margin);
+    void removeLeastUsed();
+
+    std::unordered_map<const engraving::Page*, PageList> m_pages;
+    uint64_t m_useCounter = 0;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONDISPLAYLISTS_H
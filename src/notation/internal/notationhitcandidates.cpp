@@ -0,0 +1,75 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationhitcandidates.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "libmscore/page.h"
+
+#include "realfn.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::engraving;
+
+NotationHitCandidates::NotationHitCandidates(LessThan lessThan)
+    : m_lessThan(lessThan)
+{
+}
+
+const std::vector<EngravingItem*>& NotationHitCandidates::candidates(Page* page, const PointF& p, double margin)
+{
+    int cellX = static_cast<int>(std::floor(p.x() / CELL_SIZE));
+    int cellY = static_cast<int>(std::floor(p.y() / CELL_SIZE));
+
+    if (m_page == page && m_layoutStamp == page->layoutStamp() && m_cellX == cellX && m_cellY == cellY
+        && RealIsEqual(m_margin, margin)) {
+        return m_elements;
+    }
+
+    m_page = page;
+    m_layoutStamp = page->layoutStamp();
+    m_cellX = cellX;
+    m_cellY = cellY;
+    m_margin = margin;
+
+    RectF cellRect(cellX * CELL_SIZE - margin, cellY * CELL_SIZE - margin, CELL_SIZE + 3.0 * margin, CELL_SIZE + 3.0 * margin);
+    m_elements = page->items(cellRect);
+
+    std::sort(m_elements.begin(), m_elements.end(), m_lessThan);
+
+    return m_elements;
+}
+
+const Page* NotationHitCandidates::page() const
+{
+    return m_page;
+}
+
+void NotationHitCandidates::invalidate()
+{
+    m_page = nullptr;
+    m_layoutStamp = 0;
+    m_margin = -1.0;
+    m_elements.clear();
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONHITCANDIDATES_H
+#define MU_NOTATION_NOTATIONHITCANDIDATES_H
+
+#include <cstdint>
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class Page;
+}
+
+namespace mu::notation {
+//! NOTE Page elements that may be hit around a point (in page coordinates), sorted with the given function.
+//! Queried once for a small grid cell and reused while the point stays in it and the page is not laid out again
+class NotationHitCandidates
+{
+public:
+    //! NOTE In page units, a few spatiums
+    static constexpr double CELL_SIZE = 64.0;
+
+    using LessThan = bool (*)(const engraving::EngravingItem*, const engraving::EngravingItem*);
+
+    explicit NotationHitCandidates(LessThan lessThan);
+
+    //! NOTE Covers the hit rect (p.x - margin, p.y - margin, 3 * margin, 3 * margin) of any point of the cell
+    const std::vector<engraving::EngravingItem*>& candidates(engraving::Page* page, const PointF& p, double margin);
+
+    //! NOTE The page of the last query, if any
+    const engraving::Page* page() const;
+
+    void invalidate();
+
+private:
+    LessThan m_lessThan = nullptr;
+
+    const engraving::Page* m_page = nullptr;
+    uint64_t m_layoutStamp = 0;
+    int m_cellX = 0;
+    int m_cellY = 0;
+    double m_margin = -1.0;
+    std::vector<engraving::EngravingItem*> m_elements;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONHITCANDIDATES_H
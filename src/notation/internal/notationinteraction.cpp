@@ -31,6 +31,7 @@
 #include <QKeyEvent>
 #include <QMimeData>
 
+#include "async/async.h"
 #include "defer.h"
 #include "ptrutils.h"
 #include "containers.h"
@@ -229,7 +230,23 @@ void NotationInteraction::notifyAboutNotationChanged()
 {
     TRACEFUNC;
 
+    //! NOTE The edit invalidated the BSP tree of the pages it changed, so rebuild the tree of the page under the pointer
+    //! right after the edit is shown, instead of on the first hover
+    const mu::engraving::Page* hitPage = m_hitCandidates.page();
+    m_hitCandidates.invalidate();
+
     m_notation->notifyAboutNotationChanged();
+
+    if (hitPage) {
+        async::Async::call(this, [this, hitPage]() {
+            for (mu::engraving::Page* page : score()->pages()) {
+                if (page == hitPage) {
+                    page->rebuildBspTreeIfNeeded();
+                    break;
+                }
+            }
+        });
+    }
 }
 
 void NotationInteraction::notifyAboutTextEditingStarted()
@@ -422,12 +439,15 @@ std::vector<EngravingItem*> NotationInteraction::elementsAt(const PointF& p) con
         return {};
     }
 
-    std::vector<EngravingItem*> el = page->items(p - page->pos());
-    if (el.empty()) {
-        return {};
-    }
+    PointF pagePoint = p - page->pos();
 
-    std::sort(el.begin(), el.end(), NotationInteraction::elementIsLess);
+    //! NOTE The candidates are z-ordered, so the hits are too
+    std::vector<EngravingItem*> el;
+    for (EngravingItem* element : m_hitCandidates.candidates(page, pagePoint, 0.0)) {
+        if (element->contains(pagePoint)) {
+            el.push_back(element);
+        }
+    }
 
     return el;
 }
@@ -460,7 +480,13 @@ std::vector<mu::engraving::EngravingItem*> NotationInteraction::hitElements(cons
 
     RectF r(p.x() - w, p.y() - w, 3.0 * w, 3.0 * w);
 
-    std::vector<mu::engraving::EngravingItem*> elements = page->items(r);
+    //! NOTE The same elements as the page items of the hit rect would be, but without a page query on each move
+    std::vector<mu::engraving::EngravingItem*> elements;
+    for (mu::engraving::EngravingItem* element : m_hitCandidates.candidates(page, p, w)) {
+        if (element->pageBoundingRect().intersects(r)) {
+            elements.push_back(element);
+        }
+    }
 
     for (int i = 0; i < mu::engraving::MAX_HEADERS; ++i) {
         if (score()->headerText(i) != nullptr) { // gives the ability to select the header
@@ -36,6 +36,7 @@
 #include "libmscore/engravingitem.h"
 #include "libmscore/elementgroup.h"
 #include "scorecallbacks.h"
+#include "notationhitcandidates.h"
 
 namespace mu::engraving {
 class Lasso;
@@ -395,6 +396,8 @@ private:
     DropData m_dropData;
     async::Notification m_dropChanged;
 
+    mutable NotationHitCandidates m_hitCandidates { &NotationInteraction::elementIsLess };
+
     async::Channel<ScoreConfigType> m_scoreConfigChanged;
 
     mu::engraving::Lasso* m_lasso = nullptr;
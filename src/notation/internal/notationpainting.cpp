@@ -40,6 +40,21 @@ using namespace mu::draw;
 NotationPainting::NotationPainting(Notation* notation)
     : m_notation(notation)
 {
+    engravingConfiguration()->selectionColorChanged().onReceive(this, [this](int, const draw::Color&) {
+        invalidateDisplayLists();
+    });
+
+    engravingConfiguration()->scoreInversionChanged().onNotify(this, [this]() {
+        invalidateDisplayLists();
+    });
+
+    engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        invalidateDisplayLists();
+    });
+
+    configuration()->foregroundChanged().onNotify(this, [this]() {
+        invalidateDisplayLists();
+    });
 }
 
 mu::engraving::Score* NotationPainting::score() const
@@ -152,6 +167,16 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
     int toPage = (opt.toPage >= 0 && opt.toPage < int(pages.size())) ? opt.toPage : (int(pages.size()) - 1);
 
+    //! NOTE Display lists are used only for the screen, see NotationDisplayLists
+#ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
+    bool useDisplayLists = false;
+#else
+    bool useDisplayLists = !opt.isPrinting && opt.isMultiPage;
+#endif
+    if (useDisplayLists) {
+        m_displayLists.removeStalePages(pages);
+    }
+
     for (int copy = 0; copy < opt.copyCount; ++copy) {
         bool firstPage = true;
         for (int pi = fromPage; pi <= toPage; ++pi) {
@@ -201,9 +226,12 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
 
             // Draw page elements
             painter->setClipping(true);
-            painter->setClipRect(pageRect);
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            engraving::Paint::paintElements(*painter, elements, opt.isPrinting);
+            RectF pageDrawRect = drawRect.translated(-pagePos);
+            painter->setClipRect(opt.frameRect.isValid() ? pageRect.intersected(pageDrawRect) : pageRect);
+            if (!useDisplayLists || !m_displayLists.paintPage(painter, page, pageDrawRect)) {
+                std::vector<EngravingItem*> elements = page->items(pageDrawRect);
+                engraving::Paint::paintElements(*painter, elements, opt.isPrinting);
+            }
             painter->setClipping(false);
 
 #ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
@@ -225,12 +253,19 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             }
         }
 
-        if (!opt.isPrinting) {
+        if (!opt.isPrinting && opt.isPaintInteraction) {
             static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
         }
     }
 }
 
+void NotationPainting::paintPageSheet(Painter* painter, const Page* page) const
+{
+    RectF pageRect = page->bbox();
+    RectF pageContentRect = pageRect.adjusted(page->lm(), page->tm(), -page->rm(), -page->bm());
+    paintPageSheet(painter, pageRect, pageContentRect, page->isOdd(), true);
+}
+
 void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
                                       bool printPageBackground) const
 {
@@ -289,6 +324,53 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     doPaint(painter, opt);
 }
 
+void NotationPainting::paintViewPages(Painter* painter, const RectF& frameRect)
+{
+    Options opt;
+    opt.isSetViewport = false;
+    opt.isMultiPage = true;
+    opt.frameRect = frameRect;
+    opt.deviceDpi = uiConfiguration()->logicalDpi();
+    opt.isPaintInteraction = false;
+    doPaint(painter, opt);
+}
+
+void NotationPainting::paintViewInteraction(Painter* painter)
+{
+    if (!score()) {
+        return;
+    }
+
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
+std::vector<INotationPainting::PageDisplayLists> NotationPainting::pageDisplayLists(const RectF& frameRect)
+{
+    std::vector<PageDisplayLists> result;
+    if (!score()) {
+        return result;
+    }
+
+    auto paintSheet = [this](Painter* painter, const Page* page) {
+        paintPageSheet(painter, page);
+    };
+
+    for (const Page* page : score()->pages()) {
+        RectF pageAbsRect = page->bbox().translated(page->pos());
+        if (!pageAbsRect.intersects(frameRect)) {
+            continue;
+        }
+
+        PageDisplayLists lists;
+        lists.pos = page->pos();
+        lists.rect = page->bbox();
+        m_displayLists.pageDisplayLists(page, paintSheet, lists);
+        result.push_back(std::move(lists));
+    }
+
+    return result;
+}
+
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
 {
     Q_ASSERT(opt.deviceDpi > 0);
@@ -318,3 +400,8 @@ void NotationPainting::paintPng(Painter* painter, const Options& opt)
     myopt.isPrinting = true;
     doPaint(painter, myopt);
 }
+
+void NotationPainting::invalidateDisplayLists()
+{
+    m_displayLists.invalidate();
+}
@@ -25,11 +25,14 @@
 #include "../inotationpainting.h"
 #include "igetscore.h"
 
+#include "async/asyncable.h"
 #include "modularity/ioc.h"
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
 #include "ui/iuiconfiguration.h"
 
+#include "notationdisplaylists.h"
+
 namespace mu::engraving {
 class Score;
 class Page;
@@ -37,7 +40,7 @@ class Page;
 
 namespace mu::notation {
 class Notation;
-class NotationPainting : public INotationPainting
+class NotationPainting : public INotationPainting, public async::Asyncable
 {
     INJECT(notation, INotationConfiguration, configuration)
     INJECT(notation, engraving::IEngravingConfiguration, engravingConfiguration)
@@ -53,20 +56,28 @@ public:
     SizeF pageSizeInch() const override;
 
     void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewPages(draw::Painter* painter, const RectF& frameRect) override;
+    void paintViewInteraction(draw::Painter* painter) override;
+    std::vector<PageDisplayLists> pageDisplayLists(const RectF& frameRect) override;
     void paintPdf(draw::Painter* painter, const Options& opt) override;
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
 
+    //! NOTE For changes that affect the painting without a layout (ex. selection)
+    void invalidateDisplayLists();
+
 private:
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
     void doPaint(draw::Painter* painter, const Options& opt);
     void paintPageBorder(draw::Painter* painter, const mu::engraving::Page* page) const;
+    void paintPageSheet(mu::draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(mu::draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
                         bool printPageBackground) const;
 
     Notation* m_notation = nullptr;
+    NotationDisplayLists m_displayLists;
 };
 }
 
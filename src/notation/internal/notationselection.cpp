@@ -88,13 +88,7 @@ EngravingItem* NotationSelection::element() const
 
 std::vector<EngravingItem*> NotationSelection::elements() const
 {
-    std::vector<EngravingItem*> els;
-    std::vector<mu::engraving::EngravingItem*> list = score()->selection().elements();
-    els.reserve(list.size());
-    for (mu::engraving::EngravingItem* e : list) {
-        els.push_back(e);
-    }
-    return els;
+    return score()->selection().elements();
 }
 
 std::vector<Note*> NotationSelection::notes(NoteFilter filter) const
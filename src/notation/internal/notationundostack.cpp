@@ -33,6 +33,15 @@ using namespace mu::async;
 NotationUndoStack::NotationUndoStack(IGetScore* getScore, Notification notationChanged)
     : m_getScore(getScore), m_notationChanged(notationChanged)
 {
+    //! NOTE The score reads the budget when it is created, the open scores follow the setting
+    if (engravingConfiguration()) {
+        engravingConfiguration()->undoMemoryBudgetChanged().onReceive(this, [this](size_t budget) {
+            if (undoStack()) {
+                undoStack()->setMemoryBudget(budget);
+                notifyAboutStateChanged();
+            }
+        });
+    }
 }
 
 bool NotationUndoStack::canUndo() const
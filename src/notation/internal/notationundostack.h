@@ -26,6 +26,10 @@
 #include "inotationundostack.h"
 #include "igetscore.h"
 
+#include "async/asyncable.h"
+#include "modularity/ioc.h"
+#include "engraving/iengravingconfiguration.h"
+
 namespace mu::engraving {
 class Score;
 class MasterScore;
@@ -34,8 +38,10 @@ class EditData;
 }
 
 namespace mu::notation {
-class NotationUndoStack : public INotationUndoStack
+class NotationUndoStack : public INotationUndoStack, public async::Asyncable
 {
+    INJECT(notation, engraving::IEngravingConfiguration, engravingConfiguration)
+
 public:
     NotationUndoStack(IGetScore* getScore, async::Notification notationChanged);
 
@@ -30,22 +30,32 @@ namespace notation {
 class ControlledViewMock : public IControlledView
 {
 public:
-
     MOCK_METHOD(qreal, width, (), (const, override));
     MOCK_METHOD(qreal, height, (), (const, override));
-    MOCK_METHOD(qreal, scale, (), (const, override));
-    MOCK_METHOD(QPoint, toLogical, (const QPoint& p), (const, override));
 
-    MOCK_METHOD(void, moveCanvas, (int dx, int dy), (override));
-    MOCK_METHOD(void, scrollVertical, (int dy), (override));
-    MOCK_METHOD(void, scrollHorizontal, (int dx), (override));
-    MOCK_METHOD(void, setZoom, (int, const QPoint&), (override));
+    MOCK_METHOD(PointF, viewportTopLeft, (), (const, override));
+
+    MOCK_METHOD(bool, moveCanvas, (qreal dx, qreal dy), (override));
+    MOCK_METHOD(void, moveCanvasHorizontal, (qreal dx), (override));
+    MOCK_METHOD(void, moveCanvasVertical, (qreal dy), (override));
+
+    MOCK_METHOD(RectF, notationContentRect, (), (const, override));
+    MOCK_METHOD(qreal, currentScaling, (), (const, override));
+    MOCK_METHOD(void, setScaling, (qreal scaling, const PointF& pos), (override));
+
+    MOCK_METHOD(PointF, toLogical, (const PointF& p), (const, override));
+    MOCK_METHOD(PointF, toLogical, (const QPointF& p), (const, override));
+    MOCK_METHOD(PointF, fromLogical, (const PointF& r), (const, override));
+    MOCK_METHOD(RectF, fromLogical, (const RectF& r), (const, override));
 
     MOCK_METHOD(bool, isNoteEnterMode, (), (const, override));
-    MOCK_METHOD(void, showShadowNote, (const QPointF& pos), (override));
+    MOCK_METHOD(void, showShadowNote, (const PointF& pos), (override));
+
+    MOCK_METHOD(void, showContextMenu, (const ElementType& elementType, const QPointF& pos, bool activateFocus), (override));
+    MOCK_METHOD(void, hideContextMenu, (), (override));
 
-    MOCK_METHOD(INotationInteraction*, notationInteraction, (), (const, override));
-    MOCK_METHOD(INotationPlayback*, notationPlayback, (), (const, override));
+    MOCK_METHOD(INotationInteractionPtr, notationInteraction, (), (const, override));
+    MOCK_METHOD(INotationPlaybackPtr, notationPlayback, (), (const, override));
 };
 }
 }
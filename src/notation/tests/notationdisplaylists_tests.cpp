@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <functional>
+
+#include <QImage>
+
+#include "draw/painter.h"
+
+#include "engraving/infrastructure/paint.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/page.h"
+
+#include "engraving/utests/utils/scorerw.h"
+
+#include "notation/internal/notationdisplaylists.h"
+
+using namespace mu;
+using namespace mu::draw;
+using namespace mu::engraving;
+using namespace mu::notation;
+
+static const String DISPLAY_LISTS_DIR(u"data/");
+
+class Notation_DisplayListsTests : public ::testing::Test
+{
+public:
+    static constexpr double IMAGE_SCALE = 0.5;
+
+    static QImage paintPage(const Page* page, const std::function<void(Painter& painter)>& paint)
+    {
+        QImage image(std::lrint(page->width() * IMAGE_SCALE), std::lrint(page->height() * IMAGE_SCALE),
+                     QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::white);
+
+        Painter painter(&image, "displaylists_tests");
+        painter.setAntialiasing(true);
+        painter.scale(IMAGE_SCALE, IMAGE_SCALE);
+        paint(painter);
+        painter.endDraw();
+
+        return image;
+    }
+
+    //! NOTE Pixels whose channels differ more than the rounding of the antialiasing
+    static size_t differentPixels(const QImage& image1, const QImage& image2)
+    {
+        static constexpr int TOLERANCE = 2;
+
+        size_t count = 0;
+        for (int y = 0; y < image1.height(); ++y) {
+            const QRgb* line1 = reinterpret_cast<const QRgb*>(image1.constScanLine(y));
+            const QRgb* line2 = reinterpret_cast<const QRgb*>(image2.constScanLine(y));
+            for (int x = 0; x < image1.width(); ++x) {
+                if (std::abs(qRed(line1[x]) - qRed(line2[x])) > TOLERANCE
+                    || std::abs(qGreen(line1[x]) - qGreen(line2[x])) > TOLERANCE
+                    || std::abs(qBlue(line1[x]) - qBlue(line2[x])) > TOLERANCE
+                    || std::abs(qAlpha(line1[x]) - qAlpha(line2[x])) > TOLERANCE) {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+};
+
+TEST_F(Notation_DisplayListsTests, Replay_SameAsDirectPaint)
+{
+    //! [GIVEN] Dense score
+    MasterScore* score = ScoreRW::readScore(DISPLAY_LISTS_DIR + u"hit_candidates.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    NotationDisplayLists displayLists;
+
+    for (Page* page : score->pages()) {
+        //! [WHEN] The page is painted directly, sorted by z page-wide
+        QImage direct = paintPage(page, [page](Painter& painter) {
+            Paint::paintElements(painter, page->items(page->bbox()), false);
+        });
+
+        //! [WHEN] The page is painted from the display lists (recorded on the second paint)
+        paintPage(page, [page, &displayLists](Painter& painter) {
+            EXPECT_FALSE(displayLists.paintPage(&painter, page, page->bbox()));
+        });
+
+        QImage replayed = paintPage(page, [page, &displayLists](Painter& painter) {
+            EXPECT_TRUE(displayLists.paintPage(&painter, page, page->bbox()));
+        });
+
+        //! [THEN] The pictures are the same
+        ASSERT_EQ(direct.size(), replayed.size());
+        EXPECT_EQ(differentPixels(direct, replayed), 0) << "page: " << page->no();
+    }
+
+    delete score;
+}
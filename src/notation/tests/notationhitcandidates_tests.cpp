@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/page.h"
+
+#include "engraving/utests/utils/scorerw.h"
+
+#include "notation/internal/notationhitcandidates.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::notation;
+
+static const String HIT_DIR(u"data/");
+
+class Notation_HitCandidatesTests : public ::testing::Test
+{
+public:
+    static bool isLess(const EngravingItem* e1, const EngravingItem* e2)
+    {
+        return e1->z() < e2->z();
+    }
+
+    //! NOTE The page with the most elements
+    static Page* densestPage(MasterScore* score)
+    {
+        Page* densest = nullptr;
+        size_t count = 0;
+        for (Page* page : score->pages()) {
+            size_t c = page->items(page->bbox()).size();
+            if (c > count) {
+                densest = page;
+                count = c;
+            }
+        }
+        return densest;
+    }
+
+    //! NOTE Points in page coordinates, the way the pointer moves over the page: along the rows, a few units per step
+    static std::vector<PointF> hoverPoints(const Page* page)
+    {
+        static constexpr double STEP = 5.0;
+
+        std::vector<PointF> points;
+        for (double y = 0.0; y < page->height(); y += 4 * STEP) {
+            for (double x = 0.0; x < page->width(); x += STEP) {
+                points.emplace_back(x, y);
+            }
+        }
+        return points;
+    }
+};
+
+TEST_F(Notation_HitCandidatesTests, HitElements_SameAsPageItems)
+{
+    //! [GIVEN] Dense score, about a thousand elements on a page
+    MasterScore* score = ScoreRW::readScore(HIT_DIR + u"hit_candidates.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = densestPage(score);
+    ASSERT_TRUE(page);
+
+    const double w = 4.0;
+    const std::vector<PointF> points = hoverPoints(page);
+
+    NotationHitCandidates hitCandidates(&Notation_HitCandidatesTests::isLess);
+
+    for (const PointF& p : points) {
+        //! [WHEN] Filter the candidates of the point with the hit rect
+        RectF r(p.x() - w, p.y() - w, 3.0 * w, 3.0 * w);
+
+        std::set<EngravingItem*> hits;
+        for (EngravingItem* element : hitCandidates.candidates(page, p, w)) {
+            if (element->pageBoundingRect().intersects(r)) {
+                hits.insert(element);
+            }
+        }
+
+        //! [THEN] The same elements as the page query of the hit rect
+        std::vector<EngravingItem*> items = page->items(r);
+        EXPECT_EQ(hits, std::set<EngravingItem*>(items.begin(), items.end())) << "at " << p.x() << ", " << p.y();
+    }
+
+    delete score;
+}
+
+TEST_F(Notation_HitCandidatesTests, ElementsAt_SameAsPageItems)
+{
+    //! [GIVEN] Dense score
+    MasterScore* score = ScoreRW::readScore(HIT_DIR + u"hit_candidates.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = densestPage(score);
+    ASSERT_TRUE(page);
+
+    NotationHitCandidates hitCandidates(&Notation_HitCandidatesTests::isLess);
+
+    for (const PointF& p : hoverPoints(page)) {
+        //! [WHEN] Filter the candidates of the point with the element shapes
+        std::vector<EngravingItem*> hits;
+        for (EngravingItem* element : hitCandidates.candidates(page, p, 0.0)) {
+            if (element->contains(p)) {
+                hits.push_back(element);
+            }
+        }
+
+        //! [THEN] The same elements as the page query of the point, and they are sorted
+        std::vector<EngravingItem*> items = page->items(p);
+        EXPECT_EQ(std::set<EngravingItem*>(hits.begin(), hits.end()), std::set<EngravingItem*>(items.begin(), items.end()));
+        EXPECT_TRUE(std::is_sorted(hits.begin(), hits.end(), &Notation_HitCandidatesTests::isLess));
+    }
+
+    delete score;
+}
+
+TEST_F(Notation_HitCandidatesTests, Relayout_Requeries)
+{
+    //! [GIVEN] Candidates of a point
+    MasterScore* score = ScoreRW::readScore(HIT_DIR + u"hit_candidates.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    NotationHitCandidates hitCandidates(&Notation_HitCandidatesTests::isLess);
+
+    PointF p(page->width() / 2, page->height() / 4);
+    std::vector<EngravingItem*> before = hitCandidates.candidates(page, p, 4.0);
+    uint64_t stamp = page->layoutStamp();
+
+    //! [WHEN] The page is laid out again, the tree is rebuilt the way the interaction does it after an edit
+    page->invalidateBspTree();
+    page->rebuildBspTreeIfNeeded();
+
+    //! [THEN] The page has a new stamp, so the candidates are queried again from the new tree
+    EXPECT_NE(page->layoutStamp(), stamp);
+    EXPECT_EQ(hitCandidates.candidates(page, p, 4.0), before);
+    EXPECT_EQ(hitCandidates.page(), page);
+
+    hitCandidates.invalidate();
+    EXPECT_EQ(hitCandidates.page(), nullptr);
+
+    delete score;
+}
+
+TEST_F(Notation_HitCandidatesTests, Hover_QueryTime)
+{
+    //! [GIVEN] Dense score and the pointer moving over its densest page
+    MasterScore* score = ScoreRW::readScore(HIT_DIR + u"hit_candidates.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = densestPage(score);
+    ASSERT_TRUE(page);
+
+    const double w = 4.0;
+    const std::vector<PointF> points = hoverPoints(page);
+
+    //! [WHEN] Find the hit elements of each point with the page query and with the candidates
+    using clock = std::chrono::steady_clock;
+
+    size_t pageHits = 0;
+    clock::time_point start = clock::now();
+    for (const PointF& p : points) {
+        RectF r(p.x() - w, p.y() - w, 3.0 * w, 3.0 * w);
+        std::vector<EngravingItem*> items = page->items(r);
+        std::sort(items.begin(), items.end(), &Notation_HitCandidatesTests::isLess);
+        pageHits += items.size();
+    }
+    auto pageTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+
+    NotationHitCandidates hitCandidates(&Notation_HitCandidatesTests::isLess);
+
+    size_t candidateHits = 0;
+    start = clock::now();
+    for (const PointF& p : points) {
+        RectF r(p.x() - w, p.y() - w, 3.0 * w, 3.0 * w);
+        for (EngravingItem* element : hitCandidates.candidates(page, p, w)) {
+            if (element->pageBoundingRect().intersects(r)) {
+                ++candidateHits;
+            }
+        }
+    }
+    auto candidatesTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+
+    //! [THEN] The same hits
+    EXPECT_EQ(candidateHits, pageHits);
+
+    LOGI() << "page elements: " << page->items(page->bbox()).size() << ", points: " << points.size()
+           << ", page query: " << pageTime << " us, candidates: " << candidatesTime << " us";
+
+    delete score;
+}
@@ -0,0 +1,245 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <QCoreApplication>
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "notation/view/notationtilecache.h"
+
+using namespace mu;
+using namespace mu::draw;
+using namespace mu::notation;
+
+static constexpr double TILE_SIZE = NotationTileCache::TILE_SIZE;
+static constexpr size_t TILE_BYTES = NotationTileCache::TILE_SIZE * NotationTileCache::TILE_SIZE * 4;
+
+class Notation_TileCacheTests : public ::testing::Test
+{
+public:
+    std::vector<INotationPainting::PageDisplayLists> pages(uint64_t listHash) const
+    {
+        auto provider = std::make_shared<BufferedPaintProvider>();
+        Painter painter(provider, "tilecache_tests");
+        painter.fillRect(RectF(10.0, 10.0, 100.0, 100.0), Color::black);
+        painter.endDraw();
+
+        INotationPainting::DisplayList list;
+        list.rect = RectF(0.0, 0.0, 2000.0, 2000.0);
+        list.data = std::make_shared<const DrawData>(provider->drawData());
+        list.hash = listHash;
+
+        INotationPainting::PageDisplayLists page;
+        page.rect = RectF(0.0, 0.0, 2000.0, 2000.0);
+        page.lists.push_back(list);
+
+        return { page };
+    }
+
+    //! NOTE The view at the given tile, one tile large
+    static Transform tileTransform(double scale, int x, int y)
+    {
+        return Transform(scale, 0.0, 0.0, scale, -x * TILE_SIZE, -y * TILE_SIZE);
+    }
+
+    static RectF deviceRect()
+    {
+        return RectF(0.0, 0.0, TILE_SIZE, TILE_SIZE);
+    }
+
+    //! NOTE The tiles are rendered on the worker threads, the results are taken by prepare
+    static bool waitReady(NotationTileCache& cache, const Transform& transform,
+                          const std::vector<INotationPainting::PageDisplayLists>& pages, const RectF& rect = deviceRect())
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline) {
+            QCoreApplication::processEvents();
+            if (cache.prepare(transform, rect, pages).isNull()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+};
+
+TEST_F(Notation_TileCacheTests, RendersOffThread)
+{
+    NotationTileCache cache;
+    std::vector<INotationPainting::PageDisplayLists> lists = pages(1);
+
+    int readyCount = 0;
+    QObject::connect(&cache, &NotationTileCache::tilesReady, &cache, [&readyCount]() { ++readyCount; });
+
+    //! [GIVEN] Nothing is rendered yet, the whole view must be painted directly
+    RectF missing = cache.prepare(tileTransform(1.0, 0, 0), deviceRect(), lists);
+    EXPECT_EQ(missing, RectF(0.0, 0.0, TILE_SIZE, TILE_SIZE));
+
+    //! [WHEN] The worker renders the tile
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.0, 0, 0), lists));
+
+    //! [THEN] The gui thread is notified and the tile is kept
+    EXPECT_GE(readyCount, 1);
+
+    NotationTileCache::Stats stats = cache.takeStats();
+    EXPECT_EQ(stats.tileCount, 1u);
+    EXPECT_EQ(stats.memoryUsage, TILE_BYTES);
+    EXPECT_EQ(stats.renderTimesMs.size(), 1u);
+}
+
+TEST_F(Notation_TileCacheTests, ScaleNoise_SameTiles)
+{
+    NotationTileCache cache;
+    std::vector<INotationPainting::PageDisplayLists> lists = pages(1);
+
+    //! [GIVEN] The tile is rendered for the scale
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.5, 0, 0), lists));
+
+    //! [WHEN] The scale differs only by the float error (ex. after zooming in and out)
+    RectF missing = cache.prepare(tileTransform(1.5 * 1.1 / 1.1 + 1e-12, 0, 0), deviceRect(), lists);
+
+    //! [THEN] The same tile is used
+    EXPECT_TRUE(missing.isNull());
+    EXPECT_EQ(cache.takeStats().tileCount, 1u);
+
+    //! [WHEN] The scale is changed
+    missing = cache.prepare(tileTransform(1.6, 0, 0), deviceRect(), lists);
+
+    //! [THEN] The tile is rendered again
+    EXPECT_FALSE(missing.isNull());
+}
+
+TEST_F(Notation_TileCacheTests, ChangedList_Invalidates)
+{
+    NotationTileCache cache;
+
+    //! [GIVEN] The tile is rendered
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.0, 0, 0), pages(1)));
+
+    //! [WHEN] The content of the display list is changed (ex. after an edit)
+    RectF missing = cache.prepare(tileTransform(1.0, 0, 0), deviceRect(), pages(2));
+
+    //! [THEN] The tile is not used until it is rendered again
+    EXPECT_FALSE(missing.isNull());
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.0, 0, 0), pages(2)));
+
+    //! [THEN] The new image replaced the old one
+    NotationTileCache::Stats stats = cache.takeStats();
+    EXPECT_EQ(stats.tileCount, 1u);
+    EXPECT_EQ(stats.memoryUsage, TILE_BYTES);
+}
+
+TEST_F(Notation_TileCacheTests, MemoryBudget_RemovesLeastUsed)
+{
+    //! [GIVEN] The budget is two tiles
+    NotationTileCache cache(2 * TILE_BYTES);
+    std::vector<INotationPainting::PageDisplayLists> lists = pages(1);
+
+    //! [WHEN] Three tiles are rendered one after another (scrolling)
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.0, 0, 0), lists));
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.0, 1, 0), lists));
+    ASSERT_TRUE(waitReady(cache, tileTransform(1.0, 2, 0), lists));
+
+    //! [THEN] The budget is kept
+    NotationTileCache::Stats stats = cache.takeStats();
+    EXPECT_EQ(stats.memoryUsage, 2 * TILE_BYTES);
+
+    //! [THEN] The least recently used tile was removed, the recent ones are kept
+    EXPECT_TRUE(cache.prepare(tileTransform(1.0, 1, 0), deviceRect(), lists).isNull());
+    EXPECT_FALSE(cache.prepare(tileTransform(1.0, 0, 0), deviceRect(), lists).isNull());
+}
+
+TEST_F(Notation_TileCacheTests, PixelAligned_RoundsTranslation)
+{
+    //! [GIVEN] The view transform with a fractional translation
+    Transform transform(1.5, 0.0, 0.0, 1.5, -10.3, 20.7);
+
+    //! [WHEN] It is aligned to the pixels
+    Transform aligned = NotationTileCache::pixelAligned(transform);
+
+    //! [THEN] Only the translation is rounded
+    EXPECT_DOUBLE_EQ(aligned.m11(), 1.5);
+    EXPECT_DOUBLE_EQ(aligned.m22(), 1.5);
+    EXPECT_DOUBLE_EQ(aligned.dx(), -10.0);
+    EXPECT_DOUBLE_EQ(aligned.dy(), 21.0);
+}
+
+TEST_F(Notation_TileCacheTests, Paint_SameAsDirectPaint)
+{
+    std::vector<INotationPainting::PageDisplayLists> lists = pages(1);
+
+    //! [GIVEN] The view transform with a fractional translation, on a normal and on a HiDPI device
+    for (double devicePixelRatio : { 1.0, 2.0 }) {
+        Transform devicePixelRatioScaling;
+        devicePixelRatioScaling.scale(devicePixelRatio, devicePixelRatio);
+        Transform devicePixelRatioCompensation;
+        devicePixelRatioCompensation.scale(1.0 / devicePixelRatio, 1.0 / devicePixelRatio);
+
+        Transform viewTransform(1.5, 0.0, 0.0, 1.5, 7.3, 5.6);
+        Transform pixelTransform = NotationTileCache::pixelAligned(viewTransform * devicePixelRatioScaling);
+        RectF pixelRect(0.0, 0.0, 2 * TILE_SIZE, 2 * TILE_SIZE);
+
+        auto image = [devicePixelRatio, &pixelRect]() {
+            QImage image(pixelRect.width(), pixelRect.height(), QImage::Format_ARGB32_Premultiplied);
+            image.setDevicePixelRatio(devicePixelRatio);
+            image.fill(Qt::white);
+            return image;
+        };
+
+        //! [WHEN] The view is painted from the tiles
+        NotationTileCache cache;
+        ASSERT_TRUE(waitReady(cache, pixelTransform, lists, pixelRect));
+
+        QImage tiled = image();
+        {
+            Painter painter(&tiled, "tiled");
+            cache.paint(&painter, devicePixelRatio);
+            painter.endDraw();
+        }
+
+        //! [WHEN] The view is painted directly, the way the missing tiles are painted
+        QImage direct = image();
+        {
+            Painter painter(&direct, "direct");
+            painter.setAntialiasing(true);
+            painter.setWorldTransform(pixelTransform * devicePixelRatioCompensation);
+            for (const INotationPainting::PageDisplayLists& page : lists) {
+                for (const INotationPainting::DisplayList& list : page.lists) {
+                    DrawDataPaint::paint(&painter, *list.data);
+                }
+            }
+            painter.endDraw();
+        }
+
+        //! [THEN] The pictures are the same: the tiles are placed on the same pixels and not scaled
+        EXPECT_TRUE(tiled == direct) << "device pixel ratio: " << devicePixelRatio;
+    }
+}
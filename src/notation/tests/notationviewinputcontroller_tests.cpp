@@ -23,37 +23,31 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
-using ::testing::_;
-using ::testing::Return;
+#include <QWheelEvent>
 
-#include "scenes/notation/view/notationviewinputcontroller.h"
+#include "notation/view/notationviewinputcontroller.h"
 #include "mocks/controlledviewmock.h"
-#include "mocks/notationsceneconfigurationmock.h"
+
+using ::testing::_;
+using ::testing::Return;
 
 using namespace mu;
-using namespace mu::scene::notation;
-using namespace mu::framework;
+using namespace mu::notation;
 
-class NotationViewInputControllerTests : public ::testing::Test
+class Notation_ViewInputControllerTests : public ::testing::Test
 {
 public:
-
-    ~NotationViewInputControllerTests()
-    {
-        qDeleteAll(m_events);
-    }
-
     struct Env {
         ControlledViewMock view;
         NotationViewInputController* controller = nullptr;
-        std::shared_ptr<NotationSceneConfigurationMock> configuration;
 
         Env()
         {
             controller = new NotationViewInputController(&view);
 
-            configuration = std::make_shared<NotationSceneConfigurationMock>();
-            controller->setconfiguration(configuration);
+            ON_CALL(view, width()).WillByDefault(Return(800));
+            ON_CALL(view, height()).WillByDefault(Return(500));
+            ON_CALL(view, currentScaling()).WillByDefault(Return(1.0));
         }
 
         ~Env()
@@ -62,91 +56,55 @@ public:
         }
     };
 
-    mutable QList<QInputEvent*> m_events;
-
-    QWheelEvent* make_wheelEvent(QPoint pixelDelta,
-                                 QPoint angleDelta,
-                                 Qt::KeyboardModifiers modifiers = Qt::NoModifier,
-                                 QPointF pos = QPointF(100, 100)) const
+    //! NOTE Wheel steps without the pixel delta, it is ignored on X11 anyway
+    static QWheelEvent wheelEvent(const QPoint& angleDelta, Qt::KeyboardModifiers modifiers = Qt::NoModifier)
     {
-        QPointF globalPos = pos;
-        int qt4Delta = 60;
-        Qt::Orientation qt4Orientation = Qt::Vertical;
-        Qt::MouseButtons buttons = Qt::NoButton;
-
-        QWheelEvent* ev = new QWheelEvent(pos,  globalPos,  pixelDelta,  angleDelta,
-                                          qt4Delta, qt4Orientation, buttons, modifiers);
-
-        m_events << ev;
-
-        return ev;
+        QPointF pos(100, 100);
+        return QWheelEvent(pos, pos, QPoint(), angleDelta, Qt::NoButton, modifiers, Qt::NoScrollPhase, false);
     }
 };
 
-TEST_F(NotationViewInputControllerTests, WheelEvent_ScrollVertical)
+TEST_F(Notation_ViewInputControllerTests, WheelEvent_ScrollVertical)
 {
-    //! CASE Received wheel event, without modifiers
+    //! [GIVEN] The view 500 px high, not scaled
     Env env;
 
-    //! GIVEN Has pixelDelta
-
-    //! CHECK Should be called vertical scroll with value 180
-    EXPECT_CALL(env.view, scrollVertical(180))
-    .Times(1);
-
-    env.controller->wheelEvent(make_wheelEvent(QPoint(0, 180), QPoint(0, 120)));
-
-    //! CHECK Should be called vertical scroll with value 80
-    EXPECT_CALL(env.view, scrollVertical(80))
-    .Times(1);
-
-    env.controller->wheelEvent(make_wheelEvent(QPoint(0, 80), QPoint(0, 120)));
-
-    //! GIVEN pixelDelta is Null
-    //!  dy = (angleDelta.y() * qMax(2.0, m_view->height() / 10.0)) / QWheelEvent::DefaultDeltasPerStep;
-
-    //! CHECK Should be called vertical scroll with value 50  (dy = (120 * 500 / 10) / 120 = 50)
-    EXPECT_CALL(env.view, scrollVertical(50))
-    .Times(1);
-
-    EXPECT_CALL(env.view, height())
-    .WillOnce(Return(500));
+    //! [THEN] The canvas is moved by a tenth of the view height per step: dy = (120 * 500 / 10) / 120 = 50
+    EXPECT_CALL(env.view, moveCanvas(0.0, 50.0))
+    .WillOnce(Return(true));
 
-    env.controller->wheelEvent(make_wheelEvent(QPoint(), QPoint(0, 120)));
+    //! [WHEN] One wheel step without modifiers
+    QWheelEvent event = wheelEvent(QPoint(0, 120));
+    env.controller->wheelEvent(&event);
 }
 
-TEST_F(NotationViewInputControllerTests, WheelEvent_ScrollHorizontal)
+TEST_F(Notation_ViewInputControllerTests, WheelEvent_ScrollVertical_Scaled)
 {
-    //! CASE Received wheel event, with key modifier ShiftModifier
+    //! [GIVEN] The view is scaled
     Env env;
+    ON_CALL(env.view, currentScaling()).WillByDefault(Return(2.0));
 
-    //! CHECK Should be called vertical scroll with value 120
-    EXPECT_CALL(env.view, scrollHorizontal(120))
-    .Times(1);
+    //! [THEN] The canvas is moved by the same distance on the screen
+    EXPECT_CALL(env.view, moveCanvas(0.0, 25.0))
+    .WillOnce(Return(true));
 
-    env.controller->wheelEvent(make_wheelEvent(QPoint(0, 120), QPoint(), Qt::ShiftModifier));
+    //! [WHEN] One wheel step without modifiers
+    QWheelEvent event = wheelEvent(QPoint(0, 120));
+    env.controller->wheelEvent(&event);
 }
 
-TEST_F(NotationViewInputControllerTests, WheelEvent_Zoom)
+TEST_F(Notation_ViewInputControllerTests, WheelEvent_ScrollHorizontal)
 {
-    //! CASE Received wheel event, with key modifier ControlModifier
+    //! [GIVEN] The view 500 px high, not scaled
     Env env;
 
-    ValCh<int> currentZoom;
-    currentZoom.val = 100;
-
-    ON_CALL(*(env.configuration), currentZoom())
-    .WillByDefault(Return(currentZoom));
-
-    //! CHECK Should be called zoomStep with value 110
-    EXPECT_CALL(env.view, setZoom(110, QPoint(100, 100)))
+    //! [THEN] The vertical wheel step moves the canvas horizontally
+    EXPECT_CALL(env.view, moveCanvasHorizontal(50.0))
     .Times(1);
+    EXPECT_CALL(env.view, moveCanvas(_, _))
+    .Times(0);
 
-    EXPECT_CALL(env.view, height())
-    .WillOnce(Return(500));
-
-    EXPECT_CALL(env.view, toLogical(_))
-    .WillOnce(Return(QPoint(100, 100)));
-
-    env.controller->wheelEvent(make_wheelEvent(QPoint(), QPoint(0, 120), Qt::ControlModifier, QPointF(100, 100)));
+    //! [WHEN] One wheel step with Shift
+    QWheelEvent event = wheelEvent(QPoint(0, 120), Qt::ShiftModifier);
+    env.controller->wheelEvent(&event);
 }
@@ -23,6 +23,8 @@
 
 #include <QPainter>
 
+#include <chrono>
+
 #include "actions/actiontypes.h"
 #include "stringutils.h"
 #include "log.h"
@@ -206,6 +208,10 @@ void AbstractNotationPaintView::onCurrentNotationChanged()
     m_loopInMarker->setNotation(m_notation);
     m_loopOutMarker->setNotation(m_notation);
 
+    if (m_tileCache) {
+        m_tileCache->clear();
+    }
+
     if (!m_notation) {
         return;
     }
@@ -485,14 +491,22 @@ void AbstractNotationPaintView::paint(QPainter* qp)
         return;
     }
 
+    auto frameStart = std::chrono::steady_clock::now();
+
     qreal guiScaling = configuration()->guiScaling();
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
+    Transform deviceTransform = m_matrix * guiScalingCompensation;
+    painter->setWorldTransform(deviceTransform);
 
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    if (isPrinting || !NotationTileCache::isSupported(deviceTransform)) {
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    } else {
+        qreal devicePixelRatio = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+        paintPages(rect, deviceTransform, devicePixelRatio, painter);
+    }
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -507,6 +521,58 @@ void AbstractNotationPaintView::paint(QPainter* qp)
         ctx.fromLogical = [this](const PointF& pos) -> PointF { return fromLogical(pos); };
         m_continuousPanel->paint(*painter, ctx);
     }
+
+    if (framesRegister()) {
+        std::chrono::duration<double, std::milli> frameTime = std::chrono::steady_clock::now() - frameStart;
+        framesRegister()->addFrame("notation view paint", frameTime.count());
+    }
+}
+
+void AbstractNotationPaintView::paintPages(const RectF& rect, const Transform& deviceTransform, qreal devicePixelRatio,
+                                           Painter* painter)
+{
+    TRACEFUNC;
+
+    if (!m_tileCache) {
+        m_tileCache = std::make_unique<NotationTileCache>();
+        connect(m_tileCache.get(), &NotationTileCache::tilesReady, this, [this]() {
+            update();
+        }, Qt::QueuedConnection);
+    }
+
+    //! NOTE A paint device with a device pixel ratio scales the world transform on top,
+    //! the tiles are rendered in the pixels of the device
+    Transform devicePixelRatioScaling;
+    devicePixelRatioScaling.scale(devicePixelRatio, devicePixelRatio);
+    Transform pixelTransform = NotationTileCache::pixelAligned(deviceTransform * devicePixelRatioScaling);
+
+    //! NOTE The parts that are not ready are painted directly on the same pixel grid as the tiles
+    Transform devicePixelRatioCompensation;
+    devicePixelRatioCompensation.scale(1.0 / devicePixelRatio, 1.0 / devicePixelRatio);
+    painter->setWorldTransform(pixelTransform * devicePixelRatioCompensation);
+
+    qreal pixelScaling = configuration()->guiScaling() * devicePixelRatio;
+    RectF deviceRect(rect.x() * pixelScaling, rect.y() * pixelScaling, rect.width() * pixelScaling, rect.height() * pixelScaling);
+    RectF frameRect = toLogical(rect);
+
+    INotationPaintingPtr painting = notation()->painting();
+    std::vector<INotationPainting::PageDisplayLists> pages = painting->pageDisplayLists(frameRect);
+
+    //! NOTE The tiles that are not rendered yet are painted directly, the ready tiles over them
+    RectF missingRect = m_tileCache->prepare(pixelTransform, deviceRect, pages);
+    if (missingRect.isValid()) {
+        painting->paintViewPages(painter, missingRect.intersected(frameRect));
+    }
+
+    m_tileCache->paint(painter, devicePixelRatio);
+
+    painting->paintViewInteraction(painter);
+
+    if (framesRegister()) {
+        for (double renderTime : m_tileCache->takeStats().renderTimesMs) {
+            framesRegister()->addFrame("notation view tile render", renderTime);
+        }
+    }
 }
 
 void AbstractNotationPaintView::onNotationSetup()
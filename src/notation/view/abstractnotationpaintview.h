@@ -45,6 +45,9 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
+
+#include "diagnostics/idiagnosticsframesregister.h"
 
 namespace mu::notation {
 class AbstractNotationPaintView : public uicomponents::QuickPaintedView, public IControlledView, public async::Asyncable,
@@ -61,6 +64,7 @@ class AbstractNotationPaintView : public uicomponents::QuickPaintedView, public
     INJECT(notation, ui::IUiContextResolver, uiContextResolver)
     INJECT(notation, ui::IMainWindow, mainWindow)
     INJECT(notation, ui::IUiActionsRegister, actionsRegister)
+    INJECT(notation, diagnostics::IDiagnosticsFramesRegister, framesRegister)
 
     Q_PROPERTY(qreal startHorizontalScrollPosition READ startHorizontalScrollPosition NOTIFY horizontalScrollChanged)
     Q_PROPERTY(qreal horizontalScrollbarSize READ horizontalScrollbarSize NOTIFY horizontalScrollChanged)
@@ -228,6 +232,7 @@ private:
     PointF alignToCurrentPageBorder(const RectF& showRect, const PointF& pos) const;
 
     void paintBackground(const RectF& rect, draw::Painter* painter);
+    void paintPages(const RectF& rect, const draw::Transform& deviceTransform, qreal devicePixelRatio, draw::Painter* painter);
 
     PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
@@ -241,6 +246,7 @@ private:
     std::unique_ptr<LoopMarker> m_loopInMarker;
     std::unique_ptr<LoopMarker> m_loopOutMarker;
     std::unique_ptr<ContinuousPanel> m_continuousPanel;
+    std::unique_ptr<NotationTileCache> m_tileCache;
 
     qreal m_previousVerticalScrollPosition = 0;
     qreal m_previousHorizontalScrollPosition = 0;
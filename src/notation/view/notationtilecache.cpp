@@ -0,0 +1,440 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <QPainter>
+
+#include "draw/utils/drawdatapaint.h"
+#include "realfn.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::draw;
+
+//! NOTE Entries without a pixmap (requested tiles) are cheap, but should not grow without limit
+static constexpr size_t MAX_TILE_COUNT = 4096;
+
+static size_t pixmapBytes(const QPixmap& pixmap)
+{
+    return static_cast<size_t>(pixmap.width()) * static_cast<size_t>(pixmap.height()) * 4;
+}
+
+NotationTileCache::NotationTileCache(size_t memoryBudget, QObject* parent)
+    : QObject(parent), m_memoryBudget(memoryBudget)
+{
+    //! NOTE Leave the cores for the main and audio threads
+    unsigned int threadCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back([this]() {
+            workerLoop();
+        });
+    }
+}
+
+NotationTileCache::~NotationTileCache()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopped = true;
+        m_jobs.clear();
+    }
+    m_jobAdded.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+int64_t NotationTileCache::scaleKey(double scale)
+{
+    static constexpr double SCALE_PRECISION = 1e6;
+    return std::llround(scale * SCALE_PRECISION);
+}
+
+bool NotationTileCache::isSupported(const Transform& deviceTransform)
+{
+    //! NOTE The extended provider (debugging) records everything that is painted, only on the main thread
+    if (Painter::extended) {
+        return false;
+    }
+
+    //! NOTE Only scale and translation, the view doesn't rotate
+    return RealIsNull(deviceTransform.m12()) && RealIsNull(deviceTransform.m21())
+           && RealIsNull(deviceTransform.m13()) && RealIsNull(deviceTransform.m23())
+           && RealIsEqual(deviceTransform.m11(), deviceTransform.m22())
+           && deviceTransform.m11() > 0.0;
+}
+
+Transform NotationTileCache::pixelAligned(const Transform& deviceTransform)
+{
+    Transform aligned;
+    aligned.setMatrix(deviceTransform.m11(), deviceTransform.m12(), deviceTransform.m13(),
+                      deviceTransform.m21(), deviceTransform.m22(), deviceTransform.m23(),
+                      std::round(deviceTransform.dx()), std::round(deviceTransform.dy()), deviceTransform.m33());
+    return aligned;
+}
+
+uint64_t NotationTileCache::tileVersion(const RectF& tileRect, const std::vector<INotationPainting::PageDisplayLists>& pages,
+                                        bool& isRenderable)
+{
+    isRenderable = true;
+
+    uint64_t version = 0;
+    auto add = [&version](uint64_t v) {
+        version = (version ^ v) * 1099511628211ULL;
+    };
+
+    for (const INotationPainting::PageDisplayLists& page : pages) {
+        RectF pageTileRect = tileRect.translated(-page.pos);
+        if (!page.rect.intersects(pageTileRect)) {
+            continue;
+        }
+
+        if (page.lists.empty()) {
+            isRenderable = false;
+            return 0;
+        }
+
+        if (version == 0) {
+            version = 14695981039346656037ULL;
+        }
+
+        add(std::hash<double> {}(page.pos.x()));
+        add(std::hash<double> {}(page.pos.y()));
+        for (const INotationPainting::DisplayList& list : page.lists) {
+            if (list.rect.intersects(pageTileRect)) {
+                add(list.hash);
+            }
+        }
+    }
+
+    //! NOTE 0 - the tile is outside of the pages, nothing to paint
+    return version;
+}
+
+RectF NotationTileCache::prepare(const Transform& deviceTransform, const RectF& deviceRect,
+                                 const std::vector<INotationPainting::PageDisplayLists>& pages)
+{
+    TRACEFUNC;
+
+    takeResults();
+
+    m_readyTiles.clear();
+
+    const Transform aligned = pixelAligned(deviceTransform);
+    const double scale = aligned.m11();
+    const int64_t key = scaleKey(scale);
+    const double dx = aligned.dx();
+    const double dy = aligned.dy();
+
+    cancelJobs(key);
+
+    //! NOTE Tiles are aligned to the canvas (logical * scale), so they stay valid while scrolling
+    const RectF canvasRect = deviceRect.translated(-dx, -dy);
+    const int x0 = static_cast<int>(std::floor(canvasRect.left() / TILE_SIZE));
+    const int x1 = static_cast<int>(std::floor((canvasRect.right() - 1) / TILE_SIZE));
+    const int y0 = static_cast<int>(std::floor(canvasRect.top() / TILE_SIZE));
+    const int y1 = static_cast<int>(std::floor((canvasRect.bottom() - 1) / TILE_SIZE));
+
+    const double logicalSize = TILE_SIZE / scale;
+    const uint64_t frame = ++m_useCounter;
+
+    RectF missingRect;
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            RectF tileRect(x * logicalSize, y * logicalSize, logicalSize, logicalSize);
+
+            bool isRenderable = true;
+            uint64_t version = tileVersion(tileRect, pages, isRenderable);
+            if (isRenderable && version == 0) {
+                continue;
+            }
+
+            TileKey tileKey { key, x, y };
+            Tile& tile = m_tiles[tileKey];
+            tile.lastUse = frame;
+
+            if (isRenderable && !tile.pixmap.isNull() && tile.version == version) {
+                PointF pos(x * TILE_SIZE + dx, y * TILE_SIZE + dy);
+                m_readyTiles.push_back({ pos, &tile });
+                continue;
+            }
+
+            missingRect.unite(tileRect);
+
+            if (isRenderable && tile.pendingVersion != version) {
+                tile.pendingVersion = version;
+                requestTile(tileKey, scale, version, tileRect, pages);
+            }
+        }
+    }
+
+    removeLeastUsed();
+
+    return missingRect;
+}
+
+void NotationTileCache::paint(Painter* painter, double devicePixelRatio)
+{
+    if (m_readyTiles.empty()) {
+        return;
+    }
+
+    //! NOTE Tiles are painted 1:1 in device pixels
+    Transform devicePixelRatioCompensation;
+    devicePixelRatioCompensation.scale(1.0 / devicePixelRatio, 1.0 / devicePixelRatio);
+
+    painter->save();
+    painter->setWorldTransform(devicePixelRatioCompensation);
+
+    for (const auto& pair : m_readyTiles) {
+        painter->drawPixmap(pair.first, pair.second->pixmap);
+    }
+
+    painter->restore();
+}
+
+void NotationTileCache::clear()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_jobs.clear();
+        m_results.clear();
+    }
+
+    m_tiles.clear();
+    m_readyTiles.clear();
+    m_memoryUsage = 0;
+}
+
+NotationTileCache::Stats NotationTileCache::takeStats()
+{
+    Stats stats;
+    stats.tileCount = m_tiles.size();
+    stats.memoryUsage = m_memoryUsage;
+    stats.renderTimesMs.swap(m_renderTimesMs);
+    return stats;
+}
+
+void NotationTileCache::requestTile(const TileKey& key, double scale, uint64_t version, const RectF& tileRect,
+                                    const std::vector<INotationPainting::PageDisplayLists>& pages)
+{
+    Job job;
+    job.key = key;
+    job.scale = scale;
+    job.version = version;
+
+    for (const INotationPainting::PageDisplayLists& page : pages) {
+        RectF pageTileRect = tileRect.translated(-page.pos);
+        if (!page.rect.intersects(pageTileRect)) {
+            continue;
+        }
+
+        INotationPainting::PageDisplayLists pageJob;
+        pageJob.pos = page.pos;
+        pageJob.rect = page.rect;
+        for (const INotationPainting::DisplayList& list : page.lists) {
+            if (list.rect.intersects(pageTileRect)) {
+                pageJob.lists.push_back(list);
+            }
+        }
+        job.pages.push_back(std::move(pageJob));
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        //! NOTE Replace the outdated request of the tile, if it is not taken yet
+        bool replaced = false;
+        for (Job& queued : m_jobs) {
+            if (!(queued.key < key) && !(key < queued.key)) {
+                queued = std::move(job);
+                replaced = true;
+                break;
+            }
+        }
+
+        if (!replaced) {
+            m_jobs.push_back(std::move(job));
+        }
+    }
+
+    m_jobAdded.notify_one();
+}
+
+void NotationTileCache::takeResults()
+{
+    std::vector<Result> results;
+    {
+        std::lock_guard lock(m_mutex);
+        results.swap(m_results);
+    }
+
+    for (Result& result : results) {
+        m_renderTimesMs.push_back(result.renderTimeMs);
+
+        auto it = m_tiles.find(result.key);
+        if (it == m_tiles.end() || it->second.pendingVersion != result.version) {
+            continue;
+        }
+
+        Tile& tile = it->second;
+        m_memoryUsage -= pixmapBytes(tile.pixmap);
+
+        //! NOTE QPixmap can only be created on the gui thread
+        tile.pixmap = QPixmap::fromImage(std::move(result.image));
+        tile.version = result.version;
+        tile.pendingVersion = 0;
+
+        m_memoryUsage += pixmapBytes(tile.pixmap);
+    }
+}
+
+void NotationTileCache::cancelJobs(int64_t currentScale)
+{
+    std::vector<TileKey> canceled;
+    {
+        std::lock_guard lock(m_mutex);
+        for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+            if (it->key.scale != currentScale) {
+                canceled.push_back(it->key);
+                it = m_jobs.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (const TileKey& key : canceled) {
+        auto it = m_tiles.find(key);
+        if (it != m_tiles.end()) {
+            it->second.pendingVersion = 0;
+        }
+    }
+}
+
+void NotationTileCache::removeLeastUsed()
+{
+    if (m_memoryUsage <= m_memoryBudget && m_tiles.size() <= MAX_TILE_COUNT) {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, TileKey> > candidates;
+    for (const auto& pair : m_tiles) {
+        //! NOTE The tiles of the current frame are kept
+        if (pair.second.lastUse != m_useCounter) {
+            candidates.push_back({ pair.second.lastUse, pair.first });
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    for (const auto& candidate : candidates) {
+        if (m_memoryUsage <= m_memoryBudget && m_tiles.size() <= MAX_TILE_COUNT) {
+            break;
+        }
+
+        auto it = m_tiles.find(candidate.second);
+        m_memoryUsage -= pixmapBytes(it->second.pixmap);
+        m_tiles.erase(it);
+    }
+}
+
+void NotationTileCache::workerLoop()
+{
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_jobAdded.wait(lock, [this]() {
+                return m_stopped || !m_jobs.empty();
+            });
+
+            if (m_stopped) {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        QImage image = render(job);
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_stopped) {
+                return;
+            }
+
+            Result result;
+            result.key = job.key;
+            result.version = job.version;
+            result.image = std::move(image);
+            result.renderTimeMs = elapsed.count();
+            m_results.push_back(std::move(result));
+        }
+
+        //! NOTE Queued to the gui thread
+        emit tilesReady();
+    }
+}
+
+QImage NotationTileCache::render(const Job& job)
+{
+    QImage image(TILE_SIZE, TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter qp(&image);
+    Painter painter(&qp, "notationtile");
+    painter.setAntialiasing(true);
+
+    const double scale = job.scale;
+    const Transform base(scale, 0.0, 0.0, scale,
+                         -static_cast<double>(job.key.x) * TILE_SIZE,
+                         -static_cast<double>(job.key.y) * TILE_SIZE);
+
+    for (const INotationPainting::PageDisplayLists& page : job.pages) {
+        painter.setWorldTransform(base);
+        painter.translate(page.pos);
+
+        painter.setClipping(true);
+        painter.setClipRect(page.rect);
+        for (const INotationPainting::DisplayList& list : page.lists) {
+            DrawDataPaint::paint(&painter, *list.data);
+        }
+        painter.setClipping(false);
+    }
+
+    painter.endDraw();
+
+    return image;
+}
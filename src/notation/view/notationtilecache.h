@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <QObject>
+#include <QPixmap>
+#include <QImage>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "draw/painter.h"
+#include "notation/inotationpainting.h"
+
+namespace mu::notation {
+//! NOTE Raster cache of the pages for the notation view.
+//! The canvas of each scale is split into square tiles, which are rendered on background threads
+//! from the page display lists (see INotationPainting::pageDisplayLists).
+//! A tile is identified by the content hashes of the lists it intersects,
+//! so after an edit only the tiles of the changed systems are rendered again.
+class NotationTileCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int TILE_SIZE = 256;
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 128 * 1024 * 1024;
+
+    explicit NotationTileCache(size_t memoryBudget = DEFAULT_MEMORY_BUDGET, QObject* parent = nullptr);
+    ~NotationTileCache() override;
+
+    static bool isSupported(const draw::Transform& deviceTransform);
+
+    //! NOTE The transform with the translation rounded to whole device pixels, the tiles are placed with it.
+    //! The parts that are not ready must be painted directly with it too, so both are on the same pixel grid
+    static draw::Transform pixelAligned(const draw::Transform& deviceTransform);
+
+    //! NOTE Prepares the tiles covering the device rect and requests the missing ones.
+    //! Returns the rect (in logical coordinates) covering the tiles that are not ready,
+    //! it should be painted directly before the tiles
+    RectF prepare(const draw::Transform& deviceTransform, const RectF& deviceRect,
+                  const std::vector<INotationPainting::PageDisplayLists>& pages);
+
+    //! NOTE Paints the ready tiles of the last prepare 1:1 in device pixels.
+    //! A paint device with a device pixel ratio (see QPaintDevice::devicePixelRatioF) scales the world transform on top
+    void paint(draw::Painter* painter, double devicePixelRatio = 1.0);
+
+    void clear();
+
+    struct Stats {
+        size_t tileCount = 0;
+        size_t memoryUsage = 0;
+        std::vector<double> renderTimesMs; // since the last call
+    };
+
+    Stats takeStats();
+
+signals:
+    void tilesReady();
+
+private:
+    //! NOTE The scale is quantized, so the float noise of the view transform
+    //! (ex. after zooming in and out) doesn't produce new tiles for the same zoom
+    static int64_t scaleKey(double scale);
+
+    struct TileKey {
+        int64_t scale = 0; // see scaleKey
+        int x = 0;
+        int y = 0;
+
+        bool operator<(const TileKey& other) const
+        {
+            if (scale != other.scale) {
+                return scale < other.scale;
+            }
+            if (y != other.y) {
+                return y < other.y;
+            }
+            return x < other.x;
+        }
+    };
+
+    struct Tile {
+        QPixmap pixmap;
+        uint64_t version = 0;
+        uint64_t pendingVersion = 0;
+        uint64_t lastUse = 0;
+    };
+
+    struct Job {
+        TileKey key;
+        double scale = 0.0;
+        uint64_t version = 0;
+        std::vector<INotationPainting::PageDisplayLists> pages;
+    };
+
+    struct Result {
+        TileKey key;
+        uint64_t version = 0;
+        QImage image;
+        double renderTimeMs = 0.0;
+    };
+
+    static uint64_t tileVersion(const RectF& tileRect, const std::vector<INotationPainting::PageDisplayLists>& pages,
+                                bool& isRenderable);
+    static QImage render(const Job& job);
+
+    void requestTile(const TileKey& key, double scale, uint64_t version, const RectF& tileRect,
+                     const std::vector<INotationPainting::PageDisplayLists>& pages);
+    void takeResults();
+    void cancelJobs(int64_t currentScale);
+    void removeLeastUsed();
+    void workerLoop();
+
+    size_t m_memoryBudget = 0;
+    size_t m_memoryUsage = 0;
+    uint64_t m_useCounter = 0;
+
+    std::map<TileKey, Tile> m_tiles;
+    std::vector<std::pair<PointF, const Tile*> > m_readyTiles;
+    std::vector<double> m_renderTimesMs;
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_jobAdded;
+    std::deque<Job> m_jobs;
+    std::vector<Result> m_results;
+    bool m_stopped = false;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
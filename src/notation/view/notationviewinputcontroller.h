@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_NOTATIONVIEWINPUTCONTROLLER_H
 #define MU_NOTATION_NOTATIONVIEWINPUTCONTROLLER_H
 
+#include <chrono>
+
 #include "modularity/ioc.h"
 
 #include "actions/iactionsdispatcher.h"
@@ -35,6 +37,7 @@
 #include "notation/inotationconfiguration.h"
 
 #include "playback/iplaybackcontroller.h"
+#include "diagnostics/idiagnosticsframesregister.h"
 
 class QMouseEvent;
 
@@ -79,6 +82,7 @@ class NotationViewInputController : public actions::Actionable, public async::As
     INJECT(notation, actions::IActionsDispatcher, dispatcher)
     INJECT(notation, playback::IPlaybackController, playbackController)
     INJECT(notation, context::IGlobalContext, globalContext)
+    INJECT(notation, diagnostics::IDiagnosticsFramesRegister, framesRegister)
 
 public:
     NotationViewInputController(IControlledView* view);
@@ -148,6 +152,9 @@ private:
 
     float hitWidth() const;
 
+    using TimePoint = std::chrono::steady_clock::time_point;
+    void addPointerMoveTime(const TimePoint& moveStart);
+
     struct ClickContext {
         PointF logicClickPos;
         const QMouseEvent* event = nullptr;
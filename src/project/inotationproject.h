@@ -46,6 +46,14 @@ public:
 
     virtual Ret load(const io::path_t& path,
                      const io::path_t& stylePath = io::path_t(), bool forceMode = false, const std::string& format = "") = 0;
+
+    //! NOTE load() is loadScore() followed by setupLoadedScore().
+    //! loadScore() reads and lays out the score only, without making the notation (it subscribes to the app channels),
+    //! so it may be called on a worker thread, then setupLoadedScore() is called on the main thread
+    virtual Ret loadScore(const io::path_t& path,
+                          const io::path_t& stylePath = io::path_t(), bool forceMode = false, const std::string& format = "") = 0;
+    virtual Ret setupLoadedScore() = 0;
+
     virtual Ret createNew(const ProjectCreateOptions& projectInfo) = 0;
 
     virtual bool isCloudProject() const = 0;
@@ -58,6 +58,23 @@ public:
     virtual Ret write(notation::INotationPtr notation, QIODevice& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, QIODevice& device, const Options& options = Options()) = 0;
 
+    //! NOTE Writes the pages (PER_PAGE unit) to their devices, the page number is the index of the device.
+    //! Writers may process the pages concurrently, the result is the same as writing them one by one
+    virtual Ret writePages(notation::INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options = Options())
+    {
+        for (size_t i = 0; i < devices.size(); ++i) {
+            Options pageOptions = options;
+            pageOptions[OptionKey::PAGE_NUMBER] = Val(static_cast<int>(i));
+
+            Ret ret = write(notation, *devices.at(i), pageOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
     virtual bool supportsProgressNotifications() const { return false; }
     virtual framework::Progress progress() const { return framework::Progress(); }
 
@@ -22,6 +22,7 @@
 #include "notationproject.h"
 
 #include <QBuffer>
+#include <QCryptographicHash>
 #include <QDir>
 #include <QFile>
 
@@ -119,33 +120,54 @@ NotationProject::~NotationProject()
 }
 
 void NotationProject::setupProject()
+{
+    setupEngravingProject();
+    setupNotation();
+}
+
+void NotationProject::setupEngravingProject()
 {
     m_engravingProject = EngravingProject::create();
     m_engravingProject->setFileInfoProvider(std::make_shared<ProjectFileInfoProvider>(this));
 
+    m_masterNotation = nullptr;
+    m_projectAudioSettings = std::shared_ptr<ProjectAudioSettings>(new ProjectAudioSettings());
+    m_viewSettings = std::shared_ptr<ProjectViewSettings>(new ProjectViewSettings());
+}
+
+void NotationProject::setupNotation()
+{
     m_masterNotation = std::shared_ptr<MasterNotation>(new MasterNotation());
     m_masterNotation->needSave().notification.onNotify(this, [this]() {
         m_needSaveNotification.notify();
     });
 
-    m_projectAudioSettings = std::shared_ptr<ProjectAudioSettings>(new ProjectAudioSettings());
     m_projectAudioSettings->needSave().notification.onNotify(this, [this]() {
         m_needSaveNotification.notify();
     });
 
-    m_viewSettings = std::shared_ptr<ProjectViewSettings>(new ProjectViewSettings());
     m_viewSettings->needSave().notification.onNotify(this, [this]() {
         m_needSaveNotification.notify();
     });
 }
 
 mu::Ret NotationProject::load(const io::path_t& path, const io::path_t& stylePath, bool forceMode, const std::string& format)
+{
+    Ret ret = loadScore(path, stylePath, forceMode, format);
+    if (!ret) {
+        return ret;
+    }
+
+    return setupLoadedScore();
+}
+
+mu::Ret NotationProject::loadScore(const io::path_t& path, const io::path_t& stylePath, bool forceMode, const std::string& format)
 {
     TRACEFUNC;
 
     LOGD() << "try load: " << path;
 
-    setupProject();
+    setupEngravingProject();
     setPath(path);
 
     std::string suffix = !format.empty() ? format : io::suffix(path);
@@ -153,32 +175,125 @@ mu::Ret NotationProject::load(const io::path_t& path, const io::path_t& stylePat
         return doImport(path, stylePath, forceMode);
     }
 
-    MscReader::Params params;
-    params.filePath = path.toQString();
+    if (!tryLoadSnapshot(path, stylePath, forceMode)) {
+        MscReader::Params params;
+        params.filePath = path.toQString();
 
-    params.mode = mscIoModeBySuffix(suffix);
-    IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
+        params.mode = mscIoModeBySuffix(suffix);
+        IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
+            return make_ret(Ret::Code::InternalError);
+        }
+
+        MscReader reader(params);
+        if (!reader.open()) {
+            return make_ret(engraving::Err::FileOpenError);
+        }
+
+        Ret ret = doLoad(reader, stylePath, forceMode);
+        if (!ret) {
+            LOGE() << "failed load, err: " << ret.toString();
+            return ret;
+        }
+    }
+
+    mu::engraving::MasterScore* masterScore = m_engravingProject->masterScore();
+    bool treatAsImported = masterScore->mscVersion() < 400;
+
+    masterScore->setSaved(!treatAsImported);
+
+    m_isNewlyCreated = treatAsImported;
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret NotationProject::setupLoadedScore()
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(m_engravingProject && !m_masterNotation) {
         return make_ret(Ret::Code::InternalError);
     }
 
+    setupNotation();
+    m_masterNotation->setMasterScore(m_engravingProject->masterScore());
+
+    return make_ret(Ret::Code::Ok);
+}
+
+//! NOTE Binary snapshots of the saved and autosaved projects, kept in the app data, see NotationProject::writeSnapshot
+static const QString SNAPSHOT_SUFFIX(".snapshot");
+static const QString SNAPSHOT_STAMP_SUFFIX(".stamp");
+static constexpr int MAX_SNAPSHOTS = 16;
+
+//! NOTE Size and content hash of the file the snapshot was made of
+static QByteArray fileStamp(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    if (!hash.addData(&file)) {
+        return QByteArray();
+    }
+
+    return QByteArray::number(file.size()) + ' ' + hash.result().toHex();
+}
+
+static bool isFileStampSizeEqual(const QByteArray& stamp, const QString& filePath)
+{
+    return stamp.left(stamp.indexOf(' ')).toLongLong() == QFileInfo(filePath).size();
+}
+
+QString NotationProject::snapshotFilePath(const io::path_t& path) const
+{
+    QString filePath = QFileInfo(engraving::containerPath(path).toQString()).absoluteFilePath();
+    QByteArray key = QCryptographicHash::hash(filePath.toUtf8(), QCryptographicHash::Sha1).toHex();
+
+    return configuration()->snapshotsPath().toQString() + "/" + QString::fromLatin1(key) + SNAPSHOT_SUFFIX;
+}
+
+bool NotationProject::tryLoadSnapshot(const io::path_t& path, const io::path_t& stylePath, bool forceMode)
+{
+    QString filePath = engraving::containerPath(path).toQString();
+    if (!QFileInfo(filePath).isFile()) {
+        return false;
+    }
+
+    //! NOTE The snapshot is used only if it was made of exactly this content of the file
+    QString snapshotPath = snapshotFilePath(path);
+    QFile stampFile(snapshotPath + SNAPSHOT_STAMP_SUFFIX);
+    if (!stampFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QByteArray stamp = stampFile.readAll();
+    if (!isFileStampSizeEqual(stamp, filePath) || stamp != fileStamp(filePath)) {
+        return false;
+    }
+
+    TRACEFUNC;
+
+    MscReader::Params params;
+    params.filePath = snapshotPath;
+    params.mode = MscIoMode::Zip;
+
     MscReader reader(params);
     if (!reader.open()) {
-        return make_ret(engraving::Err::FileOpenError);
+        return false;
     }
 
     Ret ret = doLoad(reader, stylePath, forceMode);
     if (!ret) {
-        LOGE() << "failed load, err: " << ret.toString();
-        return ret;
-    }
-
-    bool treatAsImported = m_masterNotation->masterScore()->mscVersion() < 400;
-
-    m_masterNotation->masterScore()->setSaved(!treatAsImported);
+        LOGW() << "failed load snapshot, err: " << ret.toString() << ", will load: " << path;
 
-    m_isNewlyCreated = treatAsImported;
+        //! NOTE Drop the partially loaded project
+        setupEngravingProject();
+        return false;
+    }
 
-    return ret;
+    return true;
 }
 
 mu::Ret NotationProject::doLoad(engraving::MscReader& reader, const io::path_t& stylePath, bool forceMode)
@@ -223,9 +338,6 @@ mu::Ret NotationProject::doLoad(engraving::MscReader& reader, const io::path_t&
         return ret;
     }
 
-    // Set current if all success
-    m_masterNotation->setMasterScore(m_engravingProject->masterScore());
-
     return make_ret(Ret::Code::Ok);
 }
 
@@ -270,8 +382,6 @@ mu::Ret NotationProject::doImport(const io::path_t& path, const io::path_t& styl
     m_projectAudioSettings->makeDefault();
     m_viewSettings->makeDefault();
 
-    // Set current if all success
-    m_masterNotation->setMasterScore(score);
     setPath(path);
     score->setSaved(true);
     score->setMetaTag(u"originalFormat", QString::fromStdString(suffix));
@@ -414,11 +524,20 @@ mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
         Ret ret = saveScore(savePath, suffix);
         if (ret) {
             if (saveMode != SaveMode::SaveCopy) {
+                //! NOTE The snapshot of the file under the previous name is not needed anymore
+                if (!m_path.empty() && m_path != savePath) {
+                    removeSnapshot(m_path);
+                }
+
                 //! NOTE: order is important
                 m_isNewlyCreated = false;
                 m_masterNotation->masterScore()->setSaved(true);
                 setPath(savePath);
                 m_masterNotation->undoStack()->stackChanged().notify();
+
+                if (isMuseScoreFile(suffix)) {
+                    writeSnapshot(savePath);
+                }
             }
         }
 
@@ -435,7 +554,12 @@ mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
             suffix = engraving::MSCX;
         }
 
-        return saveScore(path, suffix);
+        Ret ret = saveScore(path, suffix);
+        if (ret && isMuseScoreFile(suffix)) {
+            writeSnapshot(path);
+        }
+
+        return ret;
     }
 
     return make_ret(notation::Err::UnknownError);
@@ -634,6 +758,68 @@ mu::Ret NotationProject::writeProject(MscWriter& msczWriter, bool onlySelection)
     return make_ret(Ret::Code::Ok);
 }
 
+mu::Ret NotationProject::writeSnapshot(const io::path_t& path)
+{
+    TRACEFUNC;
+
+    QString filePath = engraving::containerPath(path).toQString();
+    if (!QFileInfo(filePath).isFile()) {
+        return make_ret(Ret::Code::Ok);
+    }
+
+    QString snapshotPath = snapshotFilePath(path);
+    QString stampPath = snapshotPath + SNAPSHOT_STAMP_SUFFIX;
+
+    //! NOTE Without the stamp the snapshot is never used, so a half-written one is harmless
+    fileSystem()->remove(stampPath);
+
+    Ret ret = fileSystem()->makePath(configuration()->snapshotsPath());
+    if (ret) {
+        MscWriter::Params params;
+        params.filePath = snapshotPath;
+        params.mode = MscIoMode::Zip;
+        params.binaryXml = true;
+
+        MscWriter snapshotWriter(params);
+        ret = writeProject(snapshotWriter, false);
+        snapshotWriter.close();
+    }
+
+    if (ret) {
+        QByteArray stamp = fileStamp(filePath);
+        QFile stampFile(stampPath);
+        if (stamp.isEmpty() || !stampFile.open(QIODevice::WriteOnly) || stampFile.write(stamp) != stamp.size()) {
+            ret = make_ret(Ret::Code::UnknownError);
+        }
+    }
+
+    if (!ret) {
+        LOGE() << "failed write snapshot, err: " << ret.toString();
+        removeSnapshot(path);
+        return ret;
+    }
+
+    //! NOTE Keep only the recent snapshots, the rest belong to the files renamed, moved or not opened for a long time
+    QFileInfoList snapshots = QDir(configuration()->snapshotsPath().toQString()).entryInfoList({ "*" + SNAPSHOT_SUFFIX },
+                                                                                              QDir::Files, QDir::Time);
+    for (int i = MAX_SNAPSHOTS; i < snapshots.size(); ++i) {
+        fileSystem()->remove(snapshots.at(i).filePath() + SNAPSHOT_STAMP_SUFFIX);
+        fileSystem()->remove(snapshots.at(i).filePath());
+    }
+
+    return ret;
+}
+
+void NotationProject::removeSnapshot(const io::path_t& path)
+{
+    QString snapshotPath = snapshotFilePath(path);
+
+    if (fileSystem()->exists(snapshotPath)) {
+        fileSystem()->remove(snapshotPath + SNAPSHOT_STAMP_SUFFIX);
+        fileSystem()->remove(snapshotPath);
+    }
+}
+
 mu::Ret NotationProject::saveSelectionOnScore(const mu::io::path_t& path)
 {
     IF_ASSERT_FAILED(path != m_path) {
@@ -59,6 +59,9 @@ public:
 
     Ret load(const io::path_t& path, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
              const std::string& format = "") override;
+    Ret loadScore(const io::path_t& path, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                  const std::string& format = "") override;
+    Ret setupLoadedScore() override;
     Ret createNew(const ProjectCreateOptions& projectInfo) override;
 
     io::path_t path() const override;
@@ -88,10 +91,13 @@ public:
 
 private:
     void setupProject();
+    void setupEngravingProject();
+    void setupNotation();
 
     Ret loadTemplate(const ProjectCreateOptions& projectOptions);
 
     Ret doLoad(engraving::MscReader& reader, const io::path_t& stylePath, bool forceMode);
+    bool tryLoadSnapshot(const io::path_t& path, const io::path_t& stylePath, bool forceMode);
     Ret doImport(const io::path_t& path, const io::path_t& stylePath, bool forceMode);
 
     Ret saveScore(const io::path_t& path, const std::string& fileSuffix);
@@ -100,6 +106,9 @@ private:
     Ret doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode);
     Ret makeCurrentFileAsBackup();
     Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection);
+    Ret writeSnapshot(const io::path_t& path);
+    void removeSnapshot(const io::path_t& path);
+    QString snapshotFilePath(const io::path_t& path) const;
 
     mu::engraving::EngravingProjectPtr m_engravingProject = nullptr;
     notation::MasterNotationPtr m_masterNotation = nullptr;
@@ -478,6 +478,11 @@ io::path_t ProjectConfiguration::newProjectTemporaryPath() const
     return globalConfiguration()->userAppDataPath() + "/new_project" + DEFAULT_FILE_SUFFIX;
 }
 
+io::path_t ProjectConfiguration::snapshotsPath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/snapshots";
+}
+
 bool ProjectConfiguration::isAccessibleEnabled() const
 {
     return accessibilityConfiguration()->enabled();
@@ -105,6 +105,7 @@ public:
     async::Channel<int> autoSaveIntervalChanged() const override;
 
     io::path_t newProjectTemporaryPath() const override;
+    io::path_t snapshotsPath() const override;
 
     bool isAccessibleEnabled() const override;
 
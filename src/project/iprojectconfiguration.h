@@ -104,6 +104,7 @@ public:
     virtual async::Channel<int> autoSaveIntervalChanged() const = 0;
 
     virtual io::path_t newProjectTemporaryPath() const = 0;
+    virtual io::path_t snapshotsPath() const = 0;
 
     virtual bool isAccessibleEnabled() const = 0;
 
@@ -88,6 +88,7 @@ public:
     MOCK_METHOD(async::Channel<int>, autoSaveIntervalChanged, (), (const, override));
 
     MOCK_METHOD(io::path_t, newProjectTemporaryPath, (), (const, override));
+    MOCK_METHOD(io::path_t, snapshotsPath, (), (const, override));
 
     MOCK_METHOD(bool, isAccessibleEnabled, (), (const, override));
 